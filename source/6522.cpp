@@ -46,7 +46,6 @@ void SY6522::Reset(const bool powerCycle)
 		m_isBusDriven = false;
 	}
 
-	CpuCreateCriticalSection();	// Reset() called by SY6522 global ctor, so explicitly create CPU's CriticalSection
 	Write(rDDRB, 0x00);	// DDRB = 0x00: all pins are inputs
 	Write(rDDRA, 0x00);	// DDRA = 0x00: all pins are inputs
 	Write(rACR, 0x00);	// ACR = 0x00: T1 one-shot mode
@@ -418,8 +417,8 @@ UINT SY6522::GetOpcodeCyclesForRead(BYTE reg)
 	bool indx = false;
 	bool indy = false;
 
-	const BYTE opcodeMinus3 = mem[(::regs.pc - 3) & 0xffff];
-	const BYTE opcodeMinus2 = mem[(::regs.pc - 2) & 0xffff];
+	const BYTE opcodeMinus3 = ReadByteFromMemory((::regs.pc - 3) & 0xffff);
+	const BYTE opcodeMinus2 = ReadByteFromMemory((::regs.pc - 2) & 0xffff);
 
 	// Check 2-byte opcodes
 	if (((opcodeMinus2 & 0x0f) == 0x01) && ((opcodeMinus2 & 0x10) == 0x00))	// ora (zp,x), and (zp,x), ..., sbc (zp,x)
@@ -504,8 +503,8 @@ UINT SY6522::GetOpcodeCyclesForWrite(BYTE reg)
 	bool indx = false;
 	bool indy = false;
 
-	const BYTE opcodeMinus3 = mem[(::regs.pc - 3) & 0xffff];
-	const BYTE opcodeMinus2 = mem[(::regs.pc - 2) & 0xffff];
+	const BYTE opcodeMinus3 = ReadByteFromMemory((::regs.pc - 3) & 0xffff);
+	const BYTE opcodeMinus2 = ReadByteFromMemory((::regs.pc - 2) & 0xffff);
 
 	// Check 2-byte opcodes
 	if (opcodeMinus2 == 0x81)			// sta (zp,x)
@@ -577,15 +576,15 @@ UINT SY6522::GetOpcodeCycles(BYTE reg, UINT zpOpcodeCycles, UINT opcodeCycles,
 
 	if (zpOpcode)
 	{
-		BYTE zp = mem[(::regs.pc - 1) & 0xffff];
+		BYTE zp = ReadByteFromMemory((::regs.pc - 1) & 0xffff);
 		if (indx) zp += ::regs.x;
-		zpAddr16 = (mem[zp] | (mem[(zp + 1) & 0xff] << 8));
+		zpAddr16 = (ReadByteFromMemory(zp) | (ReadByteFromMemory((zp + 1) & 0xff) << 8));
 		if (indy) zpAddr16 += ::regs.y;
 	}
 
 	if (opcode)
 	{
-		addr16 = mem[(::regs.pc - 2) & 0xffff] | (mem[(::regs.pc - 1) & 0xffff] << 8);
+		addr16 = ReadByteFromMemory((::regs.pc - 2) & 0xffff) | (ReadByteFromMemory((::regs.pc - 1) & 0xffff) << 8);
 		if (abs16y) addr16 += ::regs.y;
 		if (abs16x) addr16 += ::regs.x;
 	}
@@ -103,6 +103,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 #include "YamlHelper.h"
 
+#include <atomic>
+
 #define LOG_IRQ_TAKEN_AND_RTI 0
 
 #define	 SHORTOPCODES  22
@@ -119,6 +121,9 @@ static BYTE benchopcode[BENCHOPCODES] = {
 
 regsrec regs;
 unsigned __int64 g_nCumulativeCycles = 0;
+#ifdef LOG_PERF_TIMINGS
+unsigned __int64 g_nCumulativeInstructions = 0;	// opcodes executed (not IRQs): used by the benchmarks
+#endif
 
 static ULONG g_nCyclesExecuted;	// # of cycles executed up to last IO access
 //static signed long g_uInternalExecutedCycles;
@@ -128,11 +133,13 @@ static ULONG g_nCyclesExecuted;	// # of cycles executed up to last IO access
 // Assume all interrupt sources assert until the device is told to stop:
 // - eg by r/w to device's register or a machine reset
 
-static bool g_bCritSectionValid = false;	// Deleting CritialSection when not valid causes crash on Win98
-static CRITICAL_SECTION g_CriticalSection;	// To guard /g_bmIRQ/ & /g_bmNMI/
-static volatile UINT32 g_bmIRQ = 0;
-static volatile UINT32 g_bmNMI = 0;
-static volatile BOOL g_bNmiFlank = FALSE; // Positive going flank on NMI line
+// Interrupt lines: one bit per eIRQSRC.
+// . Asserted/deasserted with atomic read-modify-writes, as the SSC (serial & TCP) can assert from another thread.
+// . Assert uses release & the CPU's check uses acquire: device state written before CpuIrqAssert() is seen when the IRQ is taken.
+// . Only the line is synchronised: the device itself must still guard any state shared between threads.
+static std::atomic<UINT32> g_bmIRQ(0);
+static std::atomic<UINT32> g_bmNMI(0);
+static std::atomic<bool> g_bNmiFlank(false); // Positive going flank on NMI line
 
 static bool g_irqDefer1Opcode = false;
 static bool g_interruptInLastExecutionBatch = false;	// Last batch of executed cycles included an interrupt (IRQ/NMI)
@@ -140,6 +147,10 @@ static bool g_interruptInLastExecutionBatch = false;	// Last batch of executed c
 // NB. No need to save to save-state, as IRQ() follows CheckSynchronousInterruptSources(), and IRQ() always sets it to false.
 static bool g_irqOnLastOpcodeCycle = false;
 
+static bool g_bStopWhenUpdateDue = false;	// see CpuExecute()
+static bool g_bUpdateDue = false;			// see CpuUpdateDue()
+static UINT g_uStallCycles = 0;				// see CpuStall()
+
 //
 
 static eCpuType g_MainCPU = CPU_65C02;
@@ -187,7 +198,7 @@ void SetActiveCpu(eCpuType cpu)
 
 bool IsIrqAsserted(void)
 {
-	return g_bmIRQ ? true : false;
+	return g_bmIRQ.load(std::memory_order_acquire) ? true : false;
 }
 
 bool Is6502InterruptEnabled(void)
@@ -368,8 +379,8 @@ static __forceinline void Fetch(BYTE& iOpcode, ULONG uExecutedCycles)
 #endif
 
 	iOpcode = ((PC & 0xF000) == 0xC000)
-	    ? IORead[(PC>>4) & 0xFF](PC,PC,0,0,uExecutedCycles)	// Fetch opcode from I/O memory, but params are still from mem[]
-		: *(mem+PC);
+	    ? IORead[(PC>>4) & 0xFF](PC,PC,0,0,uExecutedCycles)	// Fetch opcode from I/O memory, but params are still from memread[]
+		: ReadByteFromMemory(PC);
 
 #ifdef USE_SPEECH_API
 	if ((PC == COUT1 || PC == BASICOUT) && g_Speech.IsEnabled() && !g_bFullSpeed)
@@ -377,17 +388,21 @@ static __forceinline void Fetch(BYTE& iOpcode, ULONG uExecutedCycles)
 #endif
 
 	regs.pc++;
+#ifdef LOG_PERF_TIMINGS
+	g_nCumulativeInstructions++;
+#endif
 }
 
 //#define ENABLE_NMI_SUPPORT	// Not used - so don't enable
 static __forceinline bool NMI(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn, BOOL& flagv, BOOL& flagz)
 {
 #ifdef ENABLE_NMI_SUPPORT
-	if (!g_bNmiFlank)
+	if (!g_bNmiFlank.load(std::memory_order_acquire))
 		return false;
 
 	// NMI signals are only serviced once
-	g_bNmiFlank = FALSE;
+	if (!g_bNmiFlank.exchange(false, std::memory_order_acquire))
+		return false;
 #ifdef _DEBUG
 	g_nCycleIrqStart = g_nCumulativeCycles + uExecutedCycles;
 #endif
@@ -398,7 +413,7 @@ static __forceinline bool NMI(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn,
 	regs.ps |= AF_INTERRUPT;
 	if (GetMainCpu() == CPU_65C02)	// GH#1099
 		regs.ps &= ~AF_DECIMAL;
-	regs.pc = * (WORD*) (mem+0xFFFA);
+	regs.pc = ReadWordFromMemory(0xFFFA);
 	UINT uExtraCycles = 0;	// Needed for CYC(a) macro
 	CYC(7);
 	g_interruptInLastExecutionBatch = true;
@@ -413,11 +428,13 @@ static __forceinline void CheckSynchronousInterruptSources(UINT cycles, ULONG uE
 	g_SynchronousEventMgr.Update(cycles, uExecutedCycles);
 }
 
-static __forceinline bool IRQ(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn, BOOL& flagv, BOOL& flagz)
+// Slow path of IRQ(): only reached when an IRQ is asserted and not masked.
+// Kept out of line so that the per-opcode check in the CPU cores stays small enough to be inlined.
+static bool IrqTake(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn, BOOL& flagv, BOOL& flagz)
 {
 	bool irqTaken = false;
 
-	if (g_bmIRQ && !(regs.ps & AF_INTERRUPT))
+	// NB. caller has checked: g_bmIRQ && !(regs.ps & AF_INTERRUPT)
 	{
 		// if interrupt (eg. from 6522) occurs on opcode's last cycle, then defer IRQ by 1 opcode
 		if (g_irqOnLastOpcodeCycle && !g_irqDefer1Opcode)
@@ -440,16 +457,17 @@ static __forceinline bool IRQ(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn,
 		regs.ps |= AF_INTERRUPT;
 		if (GetMainCpu() == CPU_65C02)	// GH#1099
 			regs.ps &= ~AF_DECIMAL;
-		regs.pc = * (WORD*) (mem+0xFFFE);
+		regs.pc = ReadWordFromMemory(0xFFFE);
 		UINT uExtraCycles = 0;	// Needed for CYC(a) macro
 		CYC(7);
 #if defined(_DEBUG) && LOG_IRQ_TAKEN_AND_RTI
 		std::string irq6522;
 		GetCardMgr().GetMockingboardCardMgr().Get6522IrqDescription(irq6522);
-		const char* pSrc =	(g_bmIRQ & 1) ? irq6522.c_str() :
-							(g_bmIRQ & 2) ? "SPEECH" :
-							(g_bmIRQ & 4) ? "SSC" :
-							(g_bmIRQ & 8) ? "MOUSE" : "UNKNOWN";
+		const UINT32 bmIRQ = g_bmIRQ.load(std::memory_order_relaxed);
+		const char* pSrc =	(bmIRQ & 1) ? irq6522.c_str() :
+							(bmIRQ & 2) ? "SPEECH" :
+							(bmIRQ & 4) ? "SSC" :
+							(bmIRQ & 8) ? "MOUSE" : "UNKNOWN";
 		LogOutput("IRQ (%08X) (%s)\n", (UINT)g_nCycleIrqStart, pSrc);
 #endif
 		g_interruptInLastExecutionBatch = true;
@@ -460,6 +478,15 @@ static __forceinline bool IRQ(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn,
 	return irqTaken;
 }
 
+static __forceinline bool IRQ(ULONG& uExecutedCycles, BOOL& flagc, BOOL& flagn, BOOL& flagv, BOOL& flagz)
+{
+	if (g_bmIRQ.load(std::memory_order_acquire) && !(regs.ps & AF_INTERRUPT))
+		return IrqTake(uExecutedCycles, flagc, flagn, flagv, flagz);
+
+	g_irqOnLastOpcodeCycle = false;
+	return false;
+}
+
 //===========================================================================
 
 #define READ _READ_WITH_IO_F8xx
@@ -607,7 +634,9 @@ ULONG CpuGetCyclesThisVideoFrame(const ULONG nExecutedCycles)
 
 //===========================================================================
 
-DWORD CpuExecute(const DWORD uCycles, const bool bVideoUpdate)
+// bStopWhenUpdateDue: end early (after the opcode) if an I/O handler arms a card's Update() - see CpuUpdateDue()
+// . for callers that run to the first GetCyclesUntilUpdate(), rather than in 1ms batches
+DWORD CpuExecute(const DWORD uCycles, const bool bVideoUpdate, const bool bStopWhenUpdateDue/*=false*/)
 {
 #ifdef LOG_PERF_TIMINGS
 	extern UINT64 g_timeCpu;
@@ -616,6 +645,8 @@ DWORD CpuExecute(const DWORD uCycles, const bool bVideoUpdate)
 
 	g_nCyclesExecuted =	0;
 	g_interruptInLastExecutionBatch = false;
+	g_bStopWhenUpdateDue = bStopWhenUpdateDue;
+	g_bUpdateDue = false;
 
 #ifdef _DEBUG
 	GetCardMgr().GetMockingboardCardMgr().CheckCumulativeCycles();
@@ -624,7 +655,29 @@ DWORD CpuExecute(const DWORD uCycles, const bool bVideoUpdate)
 	// uCycles:
 	//  =0  : Do single step
 	//  >0  : Do multi-opcode emulation
-	const DWORD uExecutedCycles = InternalCpuExecute(uCycles, bVideoUpdate);
+	DWORD uExecutedCycles = InternalCpuExecute(uCycles, bVideoUpdate);
+	g_bStopWhenUpdateDue = g_bUpdateDue = false;
+
+	if (g_uStallCycles)
+	{
+		// time passes for everything but the 6502 (which has stopped after the stalling opcode)
+		const UINT uStallCycles = g_uStallCycles;
+		g_uStallCycles = 0;
+
+		CheckSynchronousInterruptSources(uStallCycles, uExecutedCycles + uStallCycles);
+		if (bVideoUpdate)
+		{
+			const UINT kMaxVideoCycles = 65 * 16;	// NTSC_VideoUpdateCycles() must be given less than a frame
+			for (UINT uCyclesLeft = uStallCycles; uCyclesLeft; )
+			{
+				const UINT uVideoCycles = uCyclesLeft < kMaxVideoCycles ? uCyclesLeft : kMaxVideoCycles;
+				NTSC_VideoUpdateCycles(uVideoCycles);
+				uCyclesLeft -= uVideoCycles;
+			}
+		}
+
+		uExecutedCycles += uStallCycles;
+	}
 
 	// Update 6522s (NB. Do this before updating g_nCumulativeCycles below)
 	// . Ensures that 6522 regs are up-to-date for any potential save-state
@@ -639,16 +692,19 @@ DWORD CpuExecute(const DWORD uCycles, const bool bVideoUpdate)
 
 //===========================================================================
 
-// Called by:
-// . CpuInitialize()
-// . SY6522.Reset()
-void CpuCreateCriticalSection(void)
+// Called by an I/O handler (or SyncEvent) which has made a card's Update() due sooner than its GetCyclesUntilUpdate() said
+// . eg. disk motor-off, SSI263 phoneme start
+void CpuUpdateDue(void)
 {
-	if (!g_bCritSectionValid)
-	{
-		InitializeCriticalSection(&g_CriticalSection);
-		g_bCritSectionValid = true;
-	}
+	g_bUpdateDue = g_bStopWhenUpdateDue;
+}
+
+// Called by an I/O handler which has done, in one go, what takes the real h/w some time (eg. fast disk)
+// . the 6502 stops after the current opcode, then the rest of the machine (video, SyncEvents) is run on by 'cycles'
+void CpuStall(const UINT cycles)
+{
+	g_uStallCycles += cycles;
+	g_bUpdateDue = true;
 }
 
 //===========================================================================
@@ -662,8 +718,6 @@ void CpuInitialize(void)
 
 	CpuReset();
 
-	CpuCreateCriticalSection();
-
 	CpuIrqReset();
 	CpuNmiReset();
 
@@ -673,26 +727,15 @@ void CpuInitialize(void)
 
 //===========================================================================
 
-void CpuDestroy()
-{
-	if (g_bCritSectionValid)
-	{
-		DeleteCriticalSection(&g_CriticalSection);
-		g_bCritSectionValid = false;
-	}
-}
-
-//===========================================================================
-
 void CpuReset()
 {
-	_ASSERT(mem != NULL);
+	_ASSERT(memread[0xFF] != NULL);
 
 	// 7 cycles
 	regs.ps |= AF_INTERRUPT;
 	if (GetMainCpu() == CPU_65C02)	// GH#1099
 		regs.ps &= ~AF_DECIMAL;
-	regs.pc = *(WORD*)(mem + 0xFFFC);
+	regs.pc = ReadWordFromMemory(0xFFFC);
 	regs.sp = 0x0100 | ((regs.sp - 3) & 0xFF);
 
 	regs.bJammed = 0;
@@ -719,19 +762,19 @@ void CpuSetupBenchmark ()
 		int opcode = 0;
 		do
 		{
-			*(mem+addr++) = benchopcode[opcode];
-			*(mem+addr++) = benchopcode[opcode];
+			WriteByteToMemory(addr++, benchopcode[opcode]);
+			WriteByteToMemory(addr++, benchopcode[opcode]);
 
 			if (opcode >= SHORTOPCODES)
-				*(mem+addr++) = 0;
+				WriteByteToMemory(addr++, 0);
 
 			if ((++opcode >= BENCHOPCODES) || ((addr & 0x0F) >= 0x0B))
 			{
-				*(mem+addr++) = 0x4C;
+				WriteByteToMemory(addr++, 0x4C);
 				// split into 2 lines to avoid -Wunsequenced and undefined behaviour
 				const BYTE value = (opcode >= BENCHOPCODES) ? 0x00 : ((addr >> 4)+1) << 4;
-				*(mem+addr++) = value;
-				*(mem+addr++) = 0x03;
+				WriteByteToMemory(addr++, value);
+				WriteByteToMemory(addr++, 0x03);
 				while (addr & 0x0F)
 					++addr;
 			}
@@ -743,55 +786,37 @@ void CpuSetupBenchmark ()
 
 void CpuIrqReset()
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	g_bmIRQ = 0;
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	g_bmIRQ.store(0, std::memory_order_release);
 }
 
 void CpuIrqAssert(eIRQSRC Device)
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	g_bmIRQ |= 1<<Device;
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	g_bmIRQ.fetch_or(1<<Device, std::memory_order_release);
 }
 
 void CpuIrqDeassert(eIRQSRC Device)
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	g_bmIRQ &= ~(1<<Device);
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	g_bmIRQ.fetch_and(~(1<<Device), std::memory_order_release);
 }
 
 //===========================================================================
 
 void CpuNmiReset()
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	g_bmNMI = 0;
-	g_bNmiFlank = FALSE;
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	g_bmNMI.store(0, std::memory_order_release);
+	g_bNmiFlank.store(false, std::memory_order_release);
 }
 
 void CpuNmiAssert(eIRQSRC Device)
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	if (g_bmNMI == 0) // NMI line is just becoming active
-	    g_bNmiFlank = TRUE;
-	g_bmNMI |= 1<<Device;
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	// The bit is set before the flank, so the CPU never sees a flank without its source
+	if (g_bmNMI.fetch_or(1<<Device, std::memory_order_release) == 0) // NMI line is just becoming active
+		g_bNmiFlank.store(true, std::memory_order_release);
 }
 
 void CpuNmiDeassert(eIRQSRC Device)
 {
-	_ASSERT(g_bCritSectionValid);
-	if (g_bCritSectionValid) EnterCriticalSection(&g_CriticalSection);
-	g_bmNMI &= ~(1<<Device);
-	if (g_bCritSectionValid) LeaveCriticalSection(&g_CriticalSection);
+	g_bmNMI.fetch_and(~(1<<Device), std::memory_order_release);
 }
 
 //===========================================================================
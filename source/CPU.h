@@ -27,12 +27,15 @@ enum {
 
 extern regsrec    regs;
 extern unsigned __int64 g_nCumulativeCycles;
+#ifdef LOG_PERF_TIMINGS
+extern unsigned __int64 g_nCumulativeInstructions;
+#endif
 
-void    CpuDestroy ();
 void    CpuCalcCycles(ULONG nExecutedCycles);
-DWORD   CpuExecute(const DWORD uCycles, const bool bVideoUpdate);
+DWORD   CpuExecute(const DWORD uCycles, const bool bVideoUpdate, const bool bStopWhenUpdateDue = false);
+void    CpuUpdateDue(void);
+void    CpuStall(const UINT cycles);
 ULONG   CpuGetCyclesThisVideoFrame(ULONG nExecutedCycles);
-void    CpuCreateCriticalSection(void);
 void    CpuInitialize(void);
 void    CpuSetupBenchmark ();
 void	CpuIrqReset();
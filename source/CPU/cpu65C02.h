@@ -331,7 +331,7 @@ static DWORD Cpu65C02(DWORD uTotalCycles, const bool bVideoUpdate)
 		}
 // NTSC_END
 
-	} while (uExecutedCycles < uTotalCycles);
+	} while (uExecutedCycles < uTotalCycles && !g_bUpdateDue);
 
 	EF_TO_AF // Emulator Flags to Apple Flags
 
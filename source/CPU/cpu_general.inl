@@ -50,21 +50,21 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 			      | AF_RESERVED | AF_BREAK;
 // CYC(a): This can be optimised, as only certain opcodes will affect uExtraCycles
 #define CYC(a)	 uExecutedCycles += (a)+uExtraCycles;
-#define POP	 (*(mem+((regs.sp >= 0x1FF) ? (regs.sp = 0x100) : ++regs.sp)))
-#define PUSH(a)	 *(mem+regs.sp--) = (a);				    \
+#define POP	 (*(memread[0x01]+(((regs.sp >= 0x1FF) ? (regs.sp = 0x100) : ++regs.sp) & 0xFF)))
+#define PUSH(a)	 *(memwrite[0x01]+(regs.sp-- & 0xFF)) = (a);	    \
 		 if (regs.sp < 0x100)					    \
 		   regs.sp = 0x1FF;
 #define _READ	(																\
 			((addr & 0xF000) == 0xC000)											\
 				? IORead[(addr>>4) & 0xFF](regs.pc,addr,0,0,uExecutedCycles)	\
-				: *(mem+addr)													\
+				: ReadByteFromMemory(addr)										\
 		)
 #define _READ_WITH_IO_F8xx (										/* GH#827 */\
 			((addr & 0xF000) == 0xC000)											\
 				? IORead[(addr>>4) & 0xFF](regs.pc,addr,0,0,uExecutedCycles)	\
 				: (addr >= 0xF800)												\
 					? IO_F8xx(regs.pc,addr,0,0,uExecutedCycles)					\
-					: *(mem+addr)												\
+					: ReadByteFromMemory(addr)									\
 		)
 #define SETNZ(a) {							    \
 		   flagn = ((a) & 0x80);				    \
@@ -73,7 +73,6 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define SETZ(a)	 flagz = !((a) & 0xFF);
 #define _WRITE(a) {																		\
 			{																			\
-				memdirty[addr >> 8] = 0xFF;												\
 				LPBYTE page = memwrite[addr >> 8];										\
 				if (page)																\
 					*(page+(addr & 0xFF)) = (BYTE)(a);									\
@@ -85,7 +84,6 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 			if (addr >= 0xF800)															\
 				IO_F8xx(regs.pc,addr,1,(BYTE)(a),uExecutedCycles);						\
 			else {																		\
-				memdirty[addr >> 8] = 0xFF;												\
 				LPBYTE page = memwrite[addr >> 8];										\
 				if (page) {																\
 					*(page+(addr & 0xFF)) = (BYTE)(a);									\
@@ -125,69 +123,69 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 *
 ***/
 
-#define ABS	 addr = *(LPWORD)(mem+regs.pc);	 regs.pc += 2;
-#define IABSX    addr = *(LPWORD)(mem+(*(LPWORD)(mem+regs.pc))+(WORD)regs.x); regs.pc += 2;
+#define ABS	 addr = ReadWordFromMemory(regs.pc);	 regs.pc += 2;
+#define IABSX    addr = ReadWordFromMemory(ReadWordFromMemory(regs.pc)+(WORD)regs.x); regs.pc += 2;
 
 // Optimised for page-cross
-#define ABSX_OPT base = *(LPWORD)(mem+regs.pc); addr = base+(WORD)regs.x; regs.pc += 2; CHECK_PAGE_CHANGE;
+#define ABSX_OPT base = ReadWordFromMemory(regs.pc); addr = base+(WORD)regs.x; regs.pc += 2; CHECK_PAGE_CHANGE;
 // Not optimised for page-cross
-#define ABSX_CONST base = *(LPWORD)(mem+regs.pc); addr = base+(WORD)regs.x; regs.pc += 2;
+#define ABSX_CONST base = ReadWordFromMemory(regs.pc); addr = base+(WORD)regs.x; regs.pc += 2;
 
 // Optimised for page-cross
-#define ABSY_OPT base = *(LPWORD)(mem+regs.pc); addr = base+(WORD)regs.y; regs.pc += 2; CHECK_PAGE_CHANGE;
+#define ABSY_OPT base = ReadWordFromMemory(regs.pc); addr = base+(WORD)regs.y; regs.pc += 2; CHECK_PAGE_CHANGE;
 // Not optimised for page-cross
-#define ABSY_CONST base = *(LPWORD)(mem+regs.pc); addr = base+(WORD)regs.y; regs.pc += 2;
+#define ABSY_CONST base = ReadWordFromMemory(regs.pc); addr = base+(WORD)regs.y; regs.pc += 2;
 
 // TODO Optimization Note (just for IABSCMOS): uExtraCycles = ((base & 0xFF) + 1) >> 8;
-#define IABS_CMOS base = *(LPWORD)(mem+regs.pc);	                          \
-		 addr = *(LPWORD)(mem+base);		                  \
+#define IABS_CMOS base = ReadWordFromMemory(regs.pc);	                          \
+		 addr = ReadWordFromMemory(base);		                  \
 		 if ((base & 0xFF) == 0xFF) uExtraCycles=1;		  \
 		 regs.pc += 2;
-#define IABS_NMOS base = *(LPWORD)(mem+regs.pc);	                          \
+#define IABS_NMOS base = ReadWordFromMemory(regs.pc);	                          \
 		 if ((base & 0xFF) == 0xFF)				  \
-		       addr = *(mem+base)+((WORD)*(mem+(base&0xFF00))<<8);\
+		       addr = ReadByteFromMemory(base)+((WORD)ReadByteFromMemory(base&0xFF00)<<8);\
 		 else                                                   \
-		       addr = *(LPWORD)(mem+base);                        \
+		       addr = ReadWordFromMemory(base);                        \
 		 regs.pc += 2;
 
 #define IMM	 addr = regs.pc++;
 
-#define INDX	 base = ((*(mem+regs.pc++))+regs.x) & 0xFF;          \
+#define INDX	 base = ((ReadByteFromMemory(regs.pc++))+regs.x) & 0xFF;          \
 		 if (base == 0xFF)                                   \
-		     addr = *(mem+0xFF)+(((WORD)*mem)<<8);           \
+		     addr = ReadByteFromMemory(0xFF)+(((WORD)ReadByteFromMemory(0x00))<<8);           \
 		 else                                                \
-		     addr = *(LPWORD)(mem+base);
+		     addr = ReadWordFromMemory(base);
 
 // Optimised for page-cross
-#define INDY_OPT	 if (*(mem+regs.pc) == 0xFF)             /*incurs an extra cycle for page-crossing*/ \
-		     base = *(mem+0xFF)+(((WORD)*mem)<<8);           \
+#define INDY_OPT	 if (ReadByteFromMemory(regs.pc) == 0xFF)             /*incurs an extra cycle for page-crossing*/ \
+		     base = ReadByteFromMemory(0xFF)+(((WORD)ReadByteFromMemory(0x00))<<8);           \
 		 else                                                \
-		     base = *(LPWORD)(mem+*(mem+regs.pc));           \
+		     base = ReadWordFromMemory(ReadByteFromMemory(regs.pc));           \
 		 regs.pc++;                                          \
 		 addr = base+(WORD)regs.y;                           \
 		 CHECK_PAGE_CHANGE;
 // Not optimised for page-cross
-#define INDY_CONST	 if (*(mem+regs.pc) == 0xFF)             /*no extra cycle for page-crossing*/ \
-		     base = *(mem+0xFF)+(((WORD)*mem)<<8);           \
+#define INDY_CONST	 if (ReadByteFromMemory(regs.pc) == 0xFF)             /*no extra cycle for page-crossing*/ \
+		     base = ReadByteFromMemory(0xFF)+(((WORD)ReadByteFromMemory(0x00))<<8);           \
 		 else                                                \
-		     base = *(LPWORD)(mem+*(mem+regs.pc));           \
+		     base = ReadWordFromMemory(ReadByteFromMemory(regs.pc));           \
 		 regs.pc++;                                          \
 		 addr = base+(WORD)regs.y;
 
-#define IZPG	 base = *(mem+regs.pc++);                            \
+#define IZPG	 base = ReadByteFromMemory(regs.pc++);                            \
 		 if (base == 0xFF)                                   \
-		     addr = *(mem+0xFF)+(((WORD)*mem)<<8);           \
+		     addr = ReadByteFromMemory(0xFF)+(((WORD)ReadByteFromMemory(0x00))<<8);           \
 		 else                                                \
-		     addr = *(LPWORD)(mem+base);
+		     addr = ReadWordFromMemory(base);
 
-#define REL	 addr = (signed char)*(mem+regs.pc++);
+#define REL	 addr = (signed char)ReadByteFromMemory(regs.pc++);
 
 // TODO Optimization Note:
 // . Opcodes that generate zero-page addresses can't be accessing $C000..$CFFF
 //   so they could be paired with special READZP/WRITEZP macros (instead of READ/WRITE)
-#define ZPG 	 addr =   *(mem+regs.pc++);
-#define ZPGX	 addr = ((*(mem+regs.pc++))+regs.x) & 0xFF;
-#define ZPGY	 addr = ((*(mem+regs.pc++))+regs.y) & 0xFF;
+#define ZPG 	 addr =   ReadByteFromMemory(regs.pc++);
+#define ZPGX	 addr = ((ReadByteFromMemory(regs.pc++))+regs.x) & 0xFF;
+#define ZPGY	 addr = ((ReadByteFromMemory(regs.pc++))+regs.y) & 0xFF;
 
 // Tidy 3 char addressing modes to keep the opcode table visually aligned, clean, and readable.
 #undef asl
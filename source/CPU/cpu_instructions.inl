@@ -314,7 +314,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 		 EF_TO_AF						    \
 		 PUSH(regs.ps);						    \
 		 regs.ps |= AF_INTERRUPT;				    \
-		 regs.pc = *(LPWORD)(mem+0xFFFE);
+		 regs.pc = ReadWordFromMemory(0xFFFE);
 #define BRK_CMOS	 regs.pc++;						    \
 		 PUSH(regs.pc >> 8)					    \
 		 PUSH(regs.pc & 0xFF)					    \
@@ -322,7 +322,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 		 PUSH(regs.ps);						    \
 		 regs.ps |= AF_INTERRUPT;				    \
 		 regs.ps &= ~AF_DECIMAL;	/*CMOS clears D flag*/	\
-		 regs.pc = *(LPWORD)(mem+0xFFFE);
+		 regs.pc = ReadWordFromMemory(0xFFFE);
 #define BVC	 if (!flagv) BRANCH_TAKEN;
 #define BVS	 if ( flagv) BRANCH_TAKEN;
 #define CLC	 flagc = 0;
@@ -400,10 +400,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define INY	 ++regs.y;						    \
 		 SETNZ(regs.y)
 #define JMP	 regs.pc = addr;
-#define JSR	 addr = *(LPBYTE)(mem+regs.pc); regs.pc++;	    \
+#define JSR	 addr = ReadByteFromMemory(regs.pc); regs.pc++;	    \
 		 PUSH(regs.pc >> 8)					    \
 		 PUSH(regs.pc & 0xFF)					    \
-		 regs.pc = addr | (*(LPBYTE)(mem+regs.pc)) << 8; /* GH#1257 */
+		 regs.pc = addr | ReadByteFromMemory(regs.pc) << 8; /* GH#1257 */
 #define LAS	 /*bSlowerOnPagecross = 1*/;						    \
 		 val = (BYTE)(READ & regs.sp);				    \
 		 regs.a = regs.x = (BYTE) val;				    \
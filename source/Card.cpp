@@ -20,6 +20,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 #include "StdAfx.h"
 #include "Card.h"
+#include "Core.h"
 
 #include "Uthernet1.h"
 #include "Uthernet2.h"
@@ -65,6 +66,11 @@ void Card::ThrowErrorInvalidVersion(SS_CARDTYPE type, UINT version)
 	throw std::runtime_error(msg.str());
 }
 
+ULONG Card::GetCyclesUntilUpdate(void)
+{
+	return (ULONG)(g_fCurrentCLK6502 / 1000.0);
+}
+
 void DummyCard::InitializeIO(LPBYTE pCxRomPeripheral)
 {
 	switch (QueryType())
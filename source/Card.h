@@ -29,6 +29,9 @@ enum SS_CARDTYPE
 	CT_SDMusic,			// Soundcard
 };
 
+// Card::GetCyclesUntilUpdate(): nothing time-dependent to do, so the CPU can run for as long as the caller wants
+const ULONG CYCLES_UNTIL_UPDATE_NONE = (ULONG)-1;
+
 enum SLOTS { SLOT0=0, SLOT1, SLOT2, SLOT3, SLOT4, SLOT5, SLOT6, SLOT7, NUM_SLOTS, SLOT_AUX, GAME_IO_CONNECTOR };
 
 class YamlSaveHelper;
@@ -44,6 +47,7 @@ public:
 	virtual void Destroy() = 0;
 	virtual void Reset(const bool powerCycle) = 0;
 	virtual void Update(const ULONG nExecutedCycles) = 0;
+	virtual ULONG GetCyclesUntilUpdate(void);	// cycles the CPU can execute before Update() is due (default: 1ms, as ContinueExecution())
 	virtual void SaveSnapshot(YamlSaveHelper& yamlSaveHelper) = 0;
 	virtual bool LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT version) = 0;
 
@@ -79,6 +83,7 @@ public:
 	virtual void Destroy() {}
 	virtual void Reset(const bool powerCycle) {}
 	virtual void Update(const ULONG nExecutedCycles) {}
+	virtual ULONG GetCyclesUntilUpdate(void) { return CYCLES_UNTIL_UPDATE_NONE; }
 	virtual void SaveSnapshot(YamlSaveHelper& yamlSaveHelper) {}
 	virtual bool LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT version) { _ASSERT(0); return false; }
 };
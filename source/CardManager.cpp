@@ -289,6 +289,22 @@ void CardManager::Update(const ULONG nExecutedCycles)
 	GetMockingboardCardMgr().Update(nExecutedCycles);
 }
 
+// The earliest cycle that any card needs Update() to be called
+ULONG CardManager::GetCyclesUntilUpdate(void)
+{
+	ULONG cycles = GetMockingboardCardMgr().GetCyclesUntilUpdate();
+
+	for (UINT i = SLOT0; i < NUM_SLOTS; ++i)
+	{
+		if (m_slot[i])
+		{
+			cycles = MIN(cycles, m_slot[i]->GetCyclesUntilUpdate());
+		}
+	}
+
+	return cycles;
+}
+
 void CardManager::SaveSnapshot(YamlSaveHelper& yamlSaveHelper)
 {
 	for (UINT i = SLOT0; i < NUM_SLOTS; ++i)
@@ -66,6 +66,7 @@ public:
 	void Destroy(void);
 	void Reset(const bool powerCycle);
 	void Update(const ULONG nExecutedCycles);
+	ULONG GetCyclesUntilUpdate(void);
 	void SaveSnapshot(YamlSaveHelper& yamlSaveHelper);
 
 private:
@@ -1284,7 +1284,7 @@ int CheckBreakpointsIO ()
 							if (_CheckBreakpointValue( pBP, nAddress ))
 							{
 								g_uBreakMemoryAddress = (WORD) nAddress;
-								BYTE opcode = mem[regs.pc];
+								BYTE opcode = ReadByteFromMemory(regs.pc);
 
 								if (pBP->eSource == BP_SRC_MEM_RW)
 								{
@@ -2294,7 +2294,7 @@ Update_t CmdStepOver (int nArgs)
 
 	while (nDebugSteps -- > 0)
 	{
-		int nOpcode = *(mem + regs.pc);
+		int nOpcode = ReadByteFromMemory(regs.pc);
 		WORD nExpectedAddr = (regs.pc + 3) & _6502_MEM_END; // Wrap around 64K edge case when PC = $FFFD..$FFFF: 20 xx xx
 	//	int eMode = g_aOpcodes[ nOpcode ].addrmode;
 	//	int nByte = g_aOpmodes[eMode]._nBytes;
@@ -2518,14 +2518,11 @@ Update_t CmdJSR (int nArgs)
 
 	WORD nAddress = g_aArgs[1].nValue & _6502_MEM_END;
 
-	// Mark Stack Page as dirty
-	*(memdirty+(regs.sp >> 8)) = 1;
-
 	// Push PC onto stack
-	*(mem + regs.sp) = ((regs.pc >> 8) & 0xFF);
+	*MemGetReadPtr(regs.sp) = ((regs.pc >> 8) & 0xFF);
 	regs.sp--;
 
-	*(mem + regs.sp) = ((regs.pc >> 0) - 1) & 0xFF;
+	*MemGetReadPtr(regs.sp) = ((regs.pc >> 0) - 1) & 0xFF;
 	regs.sp--;
 
 
@@ -2547,7 +2544,7 @@ Update_t CmdNOP (int nArgs)
 
 	while (nOpbytes--)
 	{
-		*(mem+regs.pc + nOpbytes) = 0xEA;
+		*MemGetReadPtr(regs.pc + nOpbytes) = 0xEA;
 	}
 
 	return UPDATE_ALL;
@@ -3828,27 +3825,27 @@ bool MemoryDumpCheck (int nArgs, WORD * pAddress_ )
 #ifdef SUPPORT_Z80_EMU
 	else if (strcmp(g_aArgs[1].sArg, "*AF") == 0)
 	{
-		nAddress = *(WORD*)(mem + REG_AF);
+		nAddress = ReadWordFromMemory(REG_AF);
 		bUpdate = true;
 	}
 	else if (strcmp(g_aArgs[1].sArg, "*BC") == 0)
 	{
-		nAddress = *(WORD*)(mem + REG_BC);
+		nAddress = ReadWordFromMemory(REG_BC);
 		bUpdate = true;
 	}
 	else if (strcmp(g_aArgs[1].sArg, "*DE") == 0)
 	{
-		nAddress = *(WORD*)(mem + REG_DE);
+		nAddress = ReadWordFromMemory(REG_DE);
 		bUpdate = true;
 	}
 	else if (strcmp(g_aArgs[1].sArg, "*HL") == 0)
 	{
-		nAddress = *(WORD*)(mem + REG_HL);
+		nAddress = ReadWordFromMemory(REG_HL);
 		bUpdate = true;
 	}
 	else if (strcmp(g_aArgs[1].sArg, "*IX") == 0)
 	{
-		nAddress = *(WORD*)(mem + REG_IX);
+		nAddress = ReadWordFromMemory(REG_IX);
 		bUpdate = true;
 	}
 #endif
@@ -4001,14 +3998,13 @@ Update_t CmdMemoryEnterByte (int nArgs)
 		WORD nData = g_aArgs[nArgs].nValue;
 		if ( nData > 0xFF)
 		{
-			*(mem + nAddress + nArgs - 2)  = (BYTE)(nData >> 0);
-			*(mem + nAddress + nArgs - 1)  = (BYTE)(nData >> 8);
+			*MemGetReadPtr(nAddress + nArgs - 2) = (BYTE)(nData >> 0);
+			*MemGetReadPtr(nAddress + nArgs - 1) = (BYTE)(nData >> 8);
 		}
 		else
 		{
-			*(mem + nAddress+nArgs-2)  = (BYTE)nData;
+			*MemGetReadPtr(nAddress+nArgs-2) = (BYTE)nData;
 		}
-		*(memdirty+(nAddress >> 8)) = 1;
 		nArgs--;
 	}
 
@@ -4031,25 +4027,14 @@ Update_t CmdMemoryEnterWord (int nArgs)
 		WORD nData = g_aArgs[nArgs].nValue;
 
 		// Little Endian
-		*(mem + nAddress + nArgs - 2)  = (BYTE)(nData >> 0);
-		*(mem + nAddress + nArgs - 1)  = (BYTE)(nData >> 8);
-
-		*(memdirty+(nAddress >> 8)) |= 1;
+		*MemGetReadPtr(nAddress + nArgs - 2) = (BYTE)(nData >> 0);
+		*MemGetReadPtr(nAddress + nArgs - 1) = (BYTE)(nData >> 8);
 		nArgs--;
 	}
 
 	return UPDATE_ALL;
 }
 
-//===========================================================================
-void MemMarkDirty ( WORD nAddressStart, WORD nAddressEnd )
-{
-	for ( int iPage = (nAddressStart >> 8); iPage <= (nAddressEnd >> 8); iPage++ )
-	{
-		*(memdirty+iPage) = 1;
-	}
-}
-
 //===========================================================================
 Update_t CmdMemoryFill (int nArgs)
 {
@@ -4085,15 +4070,13 @@ Update_t CmdMemoryFill (int nArgs)
 
 	if ((nAddressLen > 0) && (nAddressEnd <= _6502_MEM_END))
 	{
-		MemMarkDirty( nAddressStart, nAddressEnd );
-
 		nValue = g_aArgs[nArgs].nValue & 0xFF;
 		while ( nAddressLen-- ) // v2.7.0.22
 		{
 			// TODO: Optimize - split into pre_io, and post_io
 			if ((nAddress2 < _6502_IO_BEGIN) || (nAddress2 > _6502_IO_END))
 			{
-				*(mem + nAddressStart) = nValue;
+				*MemGetReadPtr(nAddressStart) = nValue;
 			}
 			nAddressStart++;
 		}
@@ -4493,7 +4476,7 @@ Update_t CmdMemoryLoad (int nArgs)
 	}
 	const std::string sLoadSaveFilePath = g_sCurrentDir + g_sMemoryLoadSaveFileName; // TODO: g_sDebugDir
 	
-	BYTE * const pMemBankBase = bBankSpecified ? MemGetBankPtr(nBank) : mem;
+	BYTE * const pMemBankBase = bBankSpecified ? MemGetBankPtr(nBank) : MemUpdateView();
 	if (!pMemBankBase)
 	{
 		ConsoleBufferPush( TEXT( "Error: Bank out of range." ) );
@@ -4531,9 +4514,11 @@ Update_t CmdMemoryLoad (int nArgs)
 		}
 		else
 		{
-			for (WORD i=(nAddressStart>>8); i!=((nAddressStart+(WORD)nAddressLen)>>8); i++)
+			// copy from the view into the memory that the CPU sees
+			for (int i=0; i<nAddressLen; i++)
 			{
-				memdirty[i] = 0xff;
+				const WORD addr = nAddressStart + i;
+				*MemGetReadPtr(addr) = pMemBankBase[addr];
 			}
 		}
 	}
@@ -4578,8 +4563,6 @@ Update_t CmdMemoryMove (int nArgs)
 
 	if ((nAddressLen > 0) && (nAddressEnd <= _6502_MEM_END))
 	{
-		MemMarkDirty( nAddressStart, nAddressEnd );
-
 //			BYTE *pSrc = mem + nAddressStart;
 //			BYTE *pDst = mem + nDst;
 //			BYTE *pEnd = pSrc + nAddressLen;
@@ -4589,7 +4572,7 @@ Update_t CmdMemoryMove (int nArgs)
 			// TODO: Optimize - split into pre_io, and post_io
 			if ((nDst < _6502_IO_BEGIN) || (nDst > _6502_IO_END))
 			{
-				*(mem + nDst) = *(mem + nAddressStart);
+				*MemGetReadPtr(nDst) = ReadByteFromMemory(nAddressStart);
 			}
 			nDst++;
 			nAddressStart++;
@@ -4832,7 +4815,7 @@ Update_t CmdMemorySave (int nArgs)
 			}
 			sLoadSaveFilePath += g_sMemoryLoadSaveFileName;
 
-			const BYTE * const pMemBankBase = bBankSpecified ? MemGetBankPtr(nBank) : mem;
+			const BYTE * const pMemBankBase = bBankSpecified ? MemGetBankPtr(nBank) : MemUpdateView();
 			if (!pMemBankBase)
 			{
 				ConsoleBufferPush( TEXT( "Error: Bank out of range." ) );
@@ -5727,7 +5710,7 @@ int _SearchMemoryFind (
 				(ms.m_iType == MEM_SEARCH_NIB_HIGH_EXACT) ||
 				(ms.m_iType == MEM_SEARCH_NIB_LOW_EXACT ))
 			{
-				BYTE nTarget = *(mem + nAddress2);
+				BYTE nTarget = ReadByteFromMemory(nAddress2);
 	
 				if (ms.m_iType == MEM_SEARCH_NIB_LOW_EXACT)
 					nTarget &= 0x0F;
@@ -5764,7 +5747,7 @@ int _SearchMemoryFind (
 						(ms.m_iType == MEM_SEARCH_NIB_HIGH_EXACT) ||
 						(ms.m_iType == MEM_SEARCH_NIB_LOW_EXACT ))
 					{
-						BYTE nTarget = *(mem + nAddress3);
+						BYTE nTarget = ReadByteFromMemory(nAddress3);
 			
 						if (ms.m_iType == MEM_SEARCH_NIB_LOW_EXACT)
 							nTarget &= 0x0F;
@@ -6566,7 +6549,7 @@ bool ParseAssemblyListing ( bool bBytesToMemory, bool bAddSymbols )
 					if (TextIsHexByte( pStart ))
 					{
 						BYTE nByte = TextConvert2CharsToByte( pStart );
-						*(mem + ((WORD)nAddress) + iByte ) = nByte;
+						*MemGetReadPtr((WORD)nAddress + iByte) = nByte;
 					}
 				}
 				g_nSourceAssembleBytes += iByte;
@@ -8589,7 +8572,7 @@ static void CheckBreakOpcode ( int iOpcode )
 
 static void UpdateLBR (void)
 {
-	const BYTE nOpcode = *(mem + regs.pc);
+	const BYTE nOpcode = ReadByteFromMemory(regs.pc);
 
 	bool isControlFlowOpcode =
 		nOpcode == OPCODE_BRK ||
@@ -8660,7 +8643,7 @@ void DebugContinueStepping (const bool bCallerWillUpdateDisplay/*=false*/)
 
 			if ( MemIsAddrCodeMemory(regs.pc) )
 			{
-				BYTE nOpcode = *(mem+regs.pc);
+				BYTE nOpcode = ReadByteFromMemory(regs.pc);
 
 				// Update profiling stats
 				int nOpmode = g_aOpcodes[ nOpcode ].nAddressMode;
@@ -230,7 +230,7 @@ int GetDisassemblyLine(WORD nBaseAddress, DisasmLine_t& line_)
 			nTarget = pData->nTargetAddress;
 		}
 		else {
-			nTarget = mem[(nBaseAddress + 1) & 0xFFFF] | (mem[(nBaseAddress + 2) & 0xFFFF] << 8);
+			nTarget = ReadByteFromMemory((nBaseAddress + 1) & 0xFFFF) | (ReadByteFromMemory((nBaseAddress + 2) & 0xFFFF) << 8);
 			if (nOpbyte == 2)
 				nTarget &= 0xFF;
 		}
@@ -352,7 +352,7 @@ int GetDisassemblyLine(WORD nBaseAddress, DisasmLine_t& line_)
 			{
 				bDisasmFormatFlags |= DISASM_FORMAT_TARGET_POINTER;
 
-				nTargetValue = *(mem + nTargetPointer) | (*(mem + ((nTargetPointer + 1) & 0xffff)) << 8);
+				nTargetValue = ReadByteFromMemory(nTargetPointer) | (ReadByteFromMemory((nTargetPointer + 1) & 0xffff) << 8);
 
 				//if (((iOpmode >= AM_A) && (iOpmode <= AM_NZ)) && (iOpmode != AM_R))
 				//	sTargetValue_ = WordToHexStr( nTargetValue ); // & 0xFFFF
@@ -457,7 +457,7 @@ void FormatOpcodeBytes(WORD nBaseAddress, DisasmLine_t& line_)
 	const char* const ep = cp + sizeof(line_.sOpCodes);
 	for (int iByte = 0; iByte < nMaxOpBytes; iByte++)
 	{
-		const BYTE nMem = mem[(nBaseAddress + iByte) & 0xFFFF];
+		const BYTE nMem = ReadByteFromMemory((nBaseAddress + iByte) & 0xFFFF);
 		if ((cp+2) < ep)
 			cp = StrBufferAppendByteAsHex(cp, nMem);
 
@@ -482,11 +482,11 @@ struct FAC_t
 
 void FAC_Unpack(WORD nAddress, FAC_t& fac_)
 {
-	BYTE e0 = *(LPBYTE)(mem + nAddress + 0);
-	BYTE m1 = *(LPBYTE)(mem + nAddress + 1);
-	BYTE m2 = *(LPBYTE)(mem + nAddress + 2);
-	BYTE m3 = *(LPBYTE)(mem + nAddress + 3);
-	BYTE m4 = *(LPBYTE)(mem + nAddress + 4);
+	BYTE e0 = ReadByteFromMemory(nAddress + 0);
+	BYTE m1 = ReadByteFromMemory(nAddress + 1);
+	BYTE m2 = ReadByteFromMemory(nAddress + 2);
+	BYTE m3 = ReadByteFromMemory(nAddress + 3);
+	BYTE m4 = ReadByteFromMemory(nAddress + 4);
 
 	// sign
 	//     EB82:A5 9D       SIGN  LDA FAC
@@ -523,8 +523,8 @@ void FormatNopcodeBytes(WORD nBaseAddress, DisasmLine_t& line_)
 
 	for (int iByte = 0; iByte < line_.nOpbyte; )
 	{
-		BYTE nTarget8  = *(LPBYTE)(mem + nBaseAddress + iByte);
-		WORD nTarget16 = *(LPWORD)(mem + nBaseAddress + iByte);
+		BYTE nTarget8  = ReadByteFromMemory(nBaseAddress + iByte);
+		WORD nTarget16 = ReadWordFromMemory(nBaseAddress + iByte);
 
 		switch (line_.iNoptype)
 		{
@@ -603,8 +603,8 @@ void FormatNopcodeBytes(WORD nBaseAddress, DisasmLine_t& line_)
 				iByte = line_.nOpbyte;
 				if ((pDst + iByte) < pEnd)
 				{
-					memcpy(pDst, mem + nBaseAddress, iByte);
-					pDst += iByte;
+					for (int i = 0; i < iByte; i++)
+						*pDst++ = ReadByteFromMemory(nBaseAddress + i);
 				}
 				*pDst = 0;
 				break;
@@ -612,7 +612,7 @@ void FormatNopcodeBytes(WORD nBaseAddress, DisasmLine_t& line_)
 			case NOP_STRING_APPLE:
 			{
 				iByte = line_.nOpbyte; // handle all bytes of text
-				const char* pSrc = (const char*)mem + nStartAddress;
+				const char* pSrc = (const char*)MemUpdateView() + nStartAddress;
 
 				if (nDisplayLen > (DISASM_DISPLAY_MAX_IMMEDIATE_LEN - 2)) // does "text" fit?
 				{
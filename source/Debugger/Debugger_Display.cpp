@@ -2271,7 +2271,7 @@ void DrawMemory ( int line, int iMemDump )
 //			}
 //			else
 			{
-				BYTE nData = (unsigned)*(LPBYTE)(mem + iAddress);
+				BYTE nData = ReadByteFromMemory(iAddress);
 
 				if (iView == MEM_VIEW_HEX)
 				{
@@ -2855,7 +2855,7 @@ void DrawStack ( int line)
 		if (nAddress <= _6502_STACK_END)
 		{
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPCODE )); // COLOR_FG_DATA_TEXT
-			PrintTextCursorX( StrFormat( "  %02X", (unsigned)*(LPBYTE)(mem+nAddress) ).c_str(), rect );
+			PrintTextCursorX( StrFormat( "  %02X", ReadByteFromMemory(nAddress) ).c_str(), rect );
 		}
 		iStack++;
 	}
@@ -2870,7 +2870,7 @@ void DrawTargets ( int line)
 
 	int aTarget[3];
 	_6502_GetTargets( regs.pc, &aTarget[0],&aTarget[1],&aTarget[2], NULL );
-	GetTargets_IgnoreDirectJSRJMP(mem[regs.pc], aTarget[2]);
+	GetTargets_IgnoreDirectJSRJMP(ReadByteFromMemory(regs.pc), aTarget[2]);
 
 	aTarget[1] = aTarget[2];	// Move down as we only have 2 lines
 
@@ -2895,9 +2895,9 @@ void DrawTargets ( int line)
 		{
 			sAddress = WordToHexStr(aTarget[iAddress]);
 			if (iAddress)
-				sData = ByteToHexStr(*(LPBYTE)(mem+aTarget[iAddress]));
+				sData = ByteToHexStr(ReadByteFromMemory(aTarget[iAddress]));
 			else
-				sData = WordToHexStr(*(LPWORD)(mem+aTarget[iAddress]));
+				sData = WordToHexStr(ReadWordFromMemory(aTarget[iAddress]));
 		}
 
 		rect.left   = DISPLAY_TARGETS_COLUMN;
@@ -2971,11 +2971,11 @@ void DrawWatches (int line)
 
 			//
 
-			BYTE nTargetL = *(LPBYTE)(mem + g_aWatches[iWatch].nAddress);
+			BYTE nTargetL = ReadByteFromMemory(g_aWatches[iWatch].nAddress);
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPCODE ));
 			PrintTextCursorX( ByteToHexStr( nTargetL ).c_str(), rect2 );
 
-			BYTE nTargetH = *(LPBYTE)(mem + ((g_aWatches[iWatch].nAddress + 1) & 0xffff));
+			BYTE nTargetH = ReadByteFromMemory((g_aWatches[iWatch].nAddress + 1) & 0xffff);
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPCODE ));
 			PrintTextCursorX( ByteToHexStr( nTargetH ).c_str(), rect2 );
 
@@ -3008,7 +3008,7 @@ void DrawWatches (int line)
 				else
 					DebuggerSetColorBG( DebuggerGetColor( BG_DATA_2 ));
 
-				BYTE nValue8 = mem[ (nTarget16 + iByte) & 0xffff ];
+				BYTE nValue8 = ReadByteFromMemory((nTarget16 + iByte) & 0xffff);
 				PrintTextCursorX( ByteToHexStr( nValue8 ).c_str(), rect2 );
 			}
 		}
@@ -3154,14 +3154,14 @@ void DrawZeroPagePointers ( int line )
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPERATOR ));
 			PrintTextCursorX( ":", rect2 );
 
-			WORD nTarget16 = (WORD)mem[ nZPAddr1 ] | ((WORD)mem[ nZPAddr2 ]<< 8);
+			WORD nTarget16 = (WORD)ReadByteFromMemory(nZPAddr1) | ((WORD)ReadByteFromMemory(nZPAddr2)<< 8);
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_ADDRESS ));
 			PrintTextCursorX( WordToHexStr( nTarget16 ).c_str(), rect2 );
 
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPERATOR ));
 			PrintTextCursorX( ":", rect2 );
 
-			BYTE nValue8 = (unsigned)*(LPBYTE)(mem + nTarget16);
+			BYTE nValue8 = ReadByteFromMemory(nTarget16);
 			DebuggerSetColorFG( DebuggerGetColor( FG_INFO_OPCODE ));
 			PrintTextCursorX( ByteToHexStr( nValue8 ).c_str(), rect2 );
 		}
@@ -3255,10 +3255,9 @@ void DrawSubWindow_Data (Update_t bUpdate)
 		std::string sAddress = WordToHexStr( iAddress );
 
 		std::string sOpcodes;
-		const BYTE* mp = mem + iAddress;
-		for ( int iByte = 0; iByte < nMaxOpcodes; ++iByte, ++mp )
+		for ( int iByte = 0; iByte < nMaxOpcodes; ++iByte )
 		{
-			StrAppendByteAsHex(sOpcodes, *mp);
+			StrAppendByteAsHex(sOpcodes, ReadByteFromMemory(iAddress + iByte));
 			sOpcodes += ' ';
 		}
 
@@ -3302,7 +3301,7 @@ void DrawSubWindow_Data (Update_t bUpdate)
 		iAddress = nAddress;
 		for ( int iByte = 0; iByte < nMaxOpcodes; iByte++ )
 		{
-			BYTE nImmediate = (unsigned)*(LPBYTE)(mem + iAddress);
+			BYTE nImmediate = ReadByteFromMemory(iAddress);
 			/*int iTextBackground = iBackground;
 			if ((iAddress >= _6502_IO_BEGIN) && (iAddress <= _6502_IO_END))
 			{
@@ -70,6 +70,8 @@ Disk2InterfaceCard::Disk2InterfaceCard(UINT slot) :
 	m_diskLastCycle = 0;
 	m_diskLastReadLatchCycle = 0;
 	m_enhanceDisk = true;
+	m_fastDisk = false;
+	m_fastDiskFailedPC = 0;
 	m_is13SectorFirmware = false;
 	m_force13SectorFirmware = false;
 	m_deferredStepperEvent = false;
@@ -99,6 +101,8 @@ Disk2InterfaceCard::~Disk2InterfaceCard(void)
 
 bool Disk2InterfaceCard::GetEnhanceDisk(void) { return m_enhanceDisk; }
 void Disk2InterfaceCard::SetEnhanceDisk(bool bEnhanceDisk) { m_enhanceDisk = bEnhanceDisk; }
+bool Disk2InterfaceCard::GetFastDisk(void) { return m_fastDisk; }
+void Disk2InterfaceCard::SetFastDisk(bool bFastDisk) { m_fastDisk = bFastDisk; m_fastDiskFailedPC = 0; }
 
 UINT   Disk2InterfaceCard::GetCurrentBitOffset  (void) { return m_floppyDrive[m_currDrive].m_disk.m_bitOffset; }
 double Disk2InterfaceCard::GetCurrentExtraCycles(void) { return m_floppyDrive[m_currDrive].m_disk.m_extraCycles; }
@@ -509,6 +513,14 @@ void __stdcall Disk2InterfaceCard::ControlMotor(WORD, WORD address, BYTE, BYTE,
 	{
 		m_floppyMotorOn = newState;
 		m_formatTrack.DriveNotWritingTrack();
+
+		if (!newState)
+		{
+			// The spin-down starts now, but Update() is charged the whole batch: so add back the cycles already executed
+			if (m_floppyDrive[m_currDrive].m_spinning)
+				m_floppyDrive[m_currDrive].m_spinning += uExecutedCycles;
+			CpuUpdateDue();	// see GetCyclesUntilUpdate()
+		}
 	}
 
 	// NB. Motor off doesn't reset the Command Decoder like reset. (UTAIIe figures 9.7 & 9.8 chip C2)
@@ -867,6 +879,8 @@ ImageError_e Disk2InterfaceCard::InsertDisk(const int drive, const std::string&
 		}
 	}
 
+	m_fastDiskFailedPC = 0;	// A different disk may be accelerated where this one wasn't
+
 	if (Error == eIMAGE_ERROR_NONE)
 	{
 		GetImageTitle(pathname.c_str(), pFloppy->m_imagename, pFloppy->m_fullname);
@@ -1397,6 +1411,46 @@ void __stdcall Disk2InterfaceCard::DataLatchReadWriteWOZ(WORD pc, WORD addr, BYT
 		GetFrame().FrameDrawDiskStatus();
 }
 
+// Read the next 4 bit-cells in one go, for a bit offset that's a multiple of 4 (so within 1 byte).
+// Returns false (and reads nothing) if any needs the per bit-cell path: a weak bit (random),
+// the end of the track, the start of a revolution or a track seam jitter.
+__forceinline bool Disk2InterfaceCard::ReadBitCells4WOZ(FloppyDrive& drive, FloppyDisk& floppy, UINT& outputBits)
+{
+	const UINT bitOffset = floppy.m_bitOffset;
+	if (bitOffset + 4 >= floppy.m_bitCount)
+		return false;
+
+	// NB. Unsigned compares: true if the offset is one of the next 4 bit-cells
+	if (floppy.m_initialBitOffset - bitOffset - 1 < 4)
+		return false;
+	if ((UINT)floppy.m_longestSyncFFBitOffsetStart - bitOffset - 1 < 4 && drive.m_phasePrecise >= (33.0 * 2) && floppy.m_longestSyncFFRunLength > 110)
+		return false;
+
+	// Last 3 bits of the head window, then the 4 new bits
+	const UINT bits = (floppy.m_trackimage[floppy.m_byte] >> (4 - (bitOffset & 4))) & 0xf;
+	const UINT window = ((drive.m_headWindow & 7) << 4) | bits;
+
+	// Each output bit is the previous head bit, unless the head window's 4 bits are all 0 (weak bit)
+	if (!(window & 0x78) || !(window & 0x3c) || !(window & 0x1e) || !(window & 0x0f))
+		return false;
+
+	outputBits = (window >> 1) & 0xf;
+	drive.m_headWindow = (drive.m_headWindow << 4) | bits;
+
+	floppy.m_bitOffset += 4;
+	if (bitOffset & 4)
+	{
+		floppy.m_bitMask = 1 << 7;
+		floppy.m_byte++;
+	}
+	else
+	{
+		floppy.m_bitMask = 1 << 3;
+	}
+
+	return true;
+}
+
 void Disk2InterfaceCard::DataLatchReadWOZ(WORD pc, WORD addr, UINT bitCellRemainder)
 {
 	// m_diskLastReadLatchCycle = g_nCumulativeCycles;	// Not used by WOZ (only by NIB)
@@ -1417,18 +1471,35 @@ void Disk2InterfaceCard::DataLatchReadWOZ(WORD pc, WORD addr, UINT bitCellRemain
 	}
 #endif
 
+	UINT outputBits = 0;
+	UINT numBits = 0;
+
 	for (UINT i = 0; i < bitCellRemainder; i++)
 	{
-		BYTE n = floppy.m_trackimage[floppy.m_byte];
+		if (!numBits)
+		{
+			if (!(floppy.m_bitOffset & 3) && bitCellRemainder - i >= 4 && ReadBitCells4WOZ(drive, floppy, outputBits))
+			{
+				numBits = 4;
+			}
+			else
+			{
+				BYTE n = floppy.m_trackimage[floppy.m_byte];
 
-		drive.m_headWindow <<= 1;
-		drive.m_headWindow |= (n & floppy.m_bitMask) ? 1 : 0;
-		BYTE outputBit = (drive.m_headWindow & 0xf)	? (drive.m_headWindow >> 1) & 1
-													: (rand() < RAND_THRESHOLD(3, 10)) ? 1 : 0;	// ~30% chance of a 1 bit (Ref: WOZ-2.0)
+				drive.m_headWindow <<= 1;
+				drive.m_headWindow |= (n & floppy.m_bitMask) ? 1 : 0;
+				outputBits = (drive.m_headWindow & 0xf)	? (drive.m_headWindow >> 1) & 1
+														: (rand() < RAND_THRESHOLD(3, 10)) ? 1 : 0;	// ~30% chance of a 1 bit (Ref: WOZ-2.0)
+				numBits = 1;
 
-		IncBitStream(floppy);
+				IncBitStream(floppy);
 
-		AddTrackSeamJitter(drive.m_phasePrecise, floppy);
+				AddTrackSeamJitter(drive.m_phasePrecise, floppy);
+			}
+		}
+
+		numBits--;
+		BYTE outputBit = (outputBits >> numBits) & 1;
 
 		m_shiftReg <<= 1;
 		m_shiftReg |= outputBit;
@@ -1790,6 +1861,8 @@ void Disk2InterfaceCard::Reset(const bool bIsPowerCycle)
 
 	ResetLogicStateSequencer();
 
+	m_fastDiskFailedPC = 0;
+
 	if (bIsPowerCycle)	// GH#460
 	{
 		// NB. This doesn't affect the drive head (ie. drive's track position)
@@ -1975,6 +2048,25 @@ void Disk2InterfaceCard::Update(const ULONG cycles)
 	}
 }
 
+// Update() only counts down the spin-down & write light: it's due when one of them expires
+ULONG Disk2InterfaceCard::GetCyclesUntilUpdate(void)
+{
+	ULONG cycles = CYCLES_UNTIL_UPDATE_NONE;
+
+	for (int i = 0; i < NUM_DRIVES; i++)
+	{
+		const FloppyDrive& drive = m_floppyDrive[i];
+
+		if (drive.m_spinning && !m_floppyMotorOn)
+			cycles = MIN(cycles, drive.m_spinning);
+
+		if (drive.m_writelight && !(m_seqFunc.writeMode && (m_currDrive == i) && drive.m_spinning))
+			cycles = MIN(cycles, drive.m_writelight);
+	}
+
+	return cycles;
+}
+
 //===========================================================================
 
 bool Disk2InterfaceCard::DriveSwap(void)
@@ -2087,6 +2179,7 @@ void Disk2InterfaceCard::SetSequencerFunction(WORD addr, ULONG executedCycles)
 		return;
 
 	const SEQFUNC oldSeqFunc = m_seqFunc.function;
+	const UINT oldWriteMode = m_seqFunc.writeMode;
 
 	switch ((addr & 3) ^ 2)
 	{
@@ -2099,6 +2192,9 @@ void Disk2InterfaceCard::SetSequencerFunction(WORD addr, ULONG executedCycles)
 	if (!m_seqFunc.writeMode)
 		m_writeStarted = false;
 
+	if (oldWriteMode && !m_seqFunc.writeMode)
+		CpuUpdateDue();	// the write light's countdown starts (see GetCyclesUntilUpdate())
+
 	if (oldSeqFunc == checkWriteProtAndInitWrite && m_seqFunc.function != checkWriteProtAndInitWrite)
 	{
 		// Use up remaining cycles before switching out of "checkWriteProtAndInitWrite" mode
@@ -2112,6 +2208,602 @@ void Disk2InterfaceCard::SetSequencerFunction(WORD addr, ULONG executedCycles)
 	}
 }
 
+//===========================================================================
+
+// Fast disk (opt-in):
+// . The first Disk II access of the boot PROM's recalibrate and sector read, of DOS 3.3's RWTS, and of the ProDOS boot block's
+//   block read, is recognised by its PC and by the 6502 code around it. The whole operation is then done on the track buffer,
+//   and the 6502 resumes at the routine's exit - so eg. DOS 3.3 boots to its prompt in a few frames.
+// . The ProDOS kernel's Disk II driver (and any other ProDOS block driver for the card) is recognised by its 1st motor-on access, and by the
+//   ProDOS global page's device vector for the unit - the block read or write is then done in the same way, returning to the driver's caller.
+// . Anything else (WOZ images, non-standard loaders, sectors that don't decode) is left to the emulated hardware.
+// . Each sector read or written stalls the 6502 for the time its data field takes to pass under the head (see CpuStall()),
+//   but not for the rotational latency or the stepper's settle time. The disk spins on under the head for the stall.
+// . The buffers the 6502 code would have denibblised through are not filled in: RWTS's $BB00-$BC55 and the PROM's $0300-$0355
+//   (and the ProDOS boot block's copy of it). Nothing reads them back after the call, and they're overwritten by the next one.
+
+static const int kFastDiskDataNibbles = 343;	// 6&2: 86 + 256 + checksum
+static const UINT kFastDiskSectorCycles = kFastDiskDataNibbles * 32;	// 32 cycles/nibble
+
+// DOS 3.3 RWTS: $BD00-$BD39 (up to the 1st access of the common path: $BD34: LDA $C08E,X)
+static const WORD kRWTSEntry = 0xBD00;
+static const BYTE kRWTSEntryCode[] =
+{
+	0x84,0x48,0x85,0x49,0xA0,0x02,0x8C,0xF8,0x06,0xA0,0x04,0x8C,0xF8,0x04,0xA0,0x01,
+	0xB1,0x48,0xAA,0xA0,0x0F,0xD1,0x48,0xF0,0x1B,0x8A,0x48,0xB1,0x48,0xAA,0x68,0x48,
+	0x91,0x48,0xBD,0x8E,0xC0,0xA0,0x08,0xBD,0x8C,0xC0,0xDD,0x8C,0xC0,0xD0,0xF6,0x88,
+	0xD0,0xF8,0x68,0xAA,0xBD,0x8E,0xC0,0xBD,0x8C,0xC0,
+};
+
+// DOS 3.3 RWTS: $BE10-$BE4C (volume & sector checks, exit) - DOS 3.3 releases differ from $BE4D
+static const WORD kRWTSExit = 0xBE10;
+static const BYTE kRWTSExitCode[] =
+{
+	0xA0,0x03,0xB1,0x48,0x48,0xA5,0x2F,0xA0,0x0E,0x91,0x48,0x68,0xF0,0x08,0xC5,0x2F,
+	0xF0,0x04,0xA9,0x20,0xD0,0xE1,0xA0,0x05,0xB1,0x48,0xA8,0xB9,0xB8,0xBF,0xC5,0x2D,
+	0xD0,0x97,0x28,0x90,0x1C,0x20,0xDC,0xB8,0x08,0xB0,0x8E,0x28,0xA2,0x00,0x86,0x26,
+	0x20,0xC2,0xB8,0xAE,0xF8,0x05,0x18,0x24,0x38,0xA0,0x0D,0x91,0x48,
+};
+
+// DOS 3.3 RWTS: $BE50-$BE94 (seek, and its per-slot/drive current track table at $0478/$04F8)
+static const WORD kRWTSSeek = 0xBE50;
+static const BYTE kRWTSSeekCode[] =
+{
+	0x60,0x20,0x2A,0xB8,0x90,0xF0,0xA9,0x10,0xB0,0xEE,0x48,0xA0,0x01,0xB1,0x3C,0x6A,
+	0x68,0x90,0x08,0x0A,0x20,0x6B,0xBE,0x4E,0x78,0x04,0x60,0x85,0x2A,0x20,0x8E,0xBE,
+	0xB9,0x78,0x04,0x24,0x35,0x30,0x03,0xB9,0xF8,0x04,0x8D,0x78,0x04,0xA5,0x2A,0x24,
+	0x35,0x30,0x05,0x99,0xF8,0x04,0x10,0x03,0x99,0x78,0x04,0x4C,0xA0,0xB9,0x8A,0x4A,
+	0x4A,0x4A,0x4A,0xA8,0x60,
+};
+
+// ProDOS boot block: $096D-$09F6 (stepper, block read, seek & the start of its copy of the PROM's sector read)
+// . block read at $0986: block ($46) into ($44), as physical sectors 4n/4n+2 (n: block & 3, +1 for blocks 4-7) of track ($41)
+static const WORD kProDOSBootCode = 0x096D;
+static const BYTE kProDOSBootCodeBytes[] =
+{
+	0xA5,0x53,0x29,0x03,0x2A,0x05,0x2B,0xAA,0xBD,0x80,0xC0,0xA9,0x2C,0xA2,0x11,0xCA,
+	0xD0,0xFD,0xE9,0x01,0xD0,0xF7,0xA6,0x2B,0x60,0xA5,0x46,0x29,0x07,0xC9,0x04,0x29,
+	0x03,0x08,0x0A,0x28,0x2A,0x85,0x3D,0xA5,0x47,0x4A,0xA5,0x46,0x6A,0x4A,0x4A,0x85,
+	0x41,0x0A,0x85,0x51,0xA5,0x45,0x85,0x27,0xA6,0x2B,0xBD,0x89,0xC0,0x20,0xBC,0x09,
+	0xE6,0x27,0xE6,0x3D,0xE6,0x3D,0xB0,0x03,0x20,0xBC,0x09,0xBC,0x88,0xC0,0x60,0xA5,
+	0x40,0x0A,0x85,0x53,0xA9,0x00,0x85,0x54,0xA5,0x53,0x85,0x50,0x38,0xE5,0x51,0xF0,
+	0x14,0xB0,0x04,0xE6,0x53,0x90,0x02,0xC6,0x53,0x38,0x20,0x6D,0x09,0xA5,0x50,0x18,
+	0x20,0x6F,0x09,0xD0,0xE3,0xA0,0x7F,0x84,0x52,0x08,0x28,0x38,0xC6,0x52,0xF0,0xCE,
+	0x18,0x08,0x88,0xF0,0xF5,0xBD,0x8C,0xC0,0x10,0xFB,
+};
+static const WORD kProDOSBootReadBlock = 0x0986;
+
+// ProDOS global page: $BF00: JMP MLI, $BF10-$BF2F: block device vectors (DEVADR) of units $00-$70 (drive 1) and $80-$F0 (drive 2)
+static const WORD kProDOSGlobalPage = 0xBF00;
+static const WORD kProDOSDevAdr = 0xBF10;
+
+static const BYTE kDiskByte62[0x40] =
+{
+	0x96,0x97,0x9A,0x9B,0x9D,0x9E,0x9F,0xA6,
+	0xA7,0xAB,0xAC,0xAD,0xAE,0xAF,0xB2,0xB3,
+	0xB4,0xB5,0xB6,0xB7,0xB9,0xBA,0xBB,0xBC,
+	0xBD,0xBE,0xBF,0xCB,0xCD,0xCE,0xCF,0xD3,
+	0xD6,0xD7,0xD9,0xDA,0xDB,0xDC,0xDD,0xDE,
+	0xDF,0xE5,0xE6,0xE7,0xE9,0xEA,0xEB,0xEC,
+	0xED,0xEE,0xEF,0xF2,0xF3,0xF4,0xF5,0xF6,
+	0xF7,0xF9,0xFA,0xFB,0xFC,0xFD,0xFE,0xFF
+};
+
+static bool IsGuestCode(const WORD addr, const BYTE* code, const UINT size)
+{
+	for (UINT i = 0; i < size; i++)
+	{
+		if (ReadByteFromMemory(addr + i) != code[i])
+			return false;
+	}
+
+	return true;
+}
+
+// Returns the stack address of the return address of the JSR that called the block driver at 'entry', or 0
+// . the JSR is either to the driver, or to a dispatcher that does a JMP or JMP() to it (eg. through DEVADR)
+// . the driver may have saved the flags (PHP, SEI) before its 1st access: 'pushedP'
+static WORD FindProDOSDriverCall(const WORD entry, bool& pushedP)
+{
+	for (UINT pushed = 0; pushed <= 1; pushed++)
+	{
+		const WORD stack = 0x100 | ((regs.sp + 1 + pushed) & 0xFF);
+		const WORD jsr = (ReadByteFromMemory(stack) | (ReadByteFromMemory(0x100 | ((stack + 1) & 0xFF)) << 8)) - 2;
+		if (ReadByteFromMemory(jsr) != 0x20)
+			continue;
+
+		pushedP = pushed != 0;
+		const WORD target = ReadWordFromMemory(jsr + 1);
+		if (target == entry)
+			return stack;
+
+		for (WORD addr = target; addr != (WORD)(target + 0x20); addr++)
+		{
+			const BYTE opcode = ReadByteFromMemory(addr);
+			const WORD operand = ReadWordFromMemory(addr + 1);
+			if ((opcode == 0x4C && operand == entry) || (opcode == 0x6C && ReadWordFromMemory(operand) == entry))
+				return stack;
+		}
+	}
+
+	return 0;
+}
+
+static BYTE FastDiskNibble(const FloppyDisk& floppy, const int offset)
+{
+	return floppy.m_trackimage[offset % floppy.m_nibbles];
+}
+
+static bool FastDiskDecodeSector(const FloppyDisk& floppy, const int offset, BYTE* data)
+{
+	static BYTE sixBitByte[0x100];
+	static bool tableGenerated = false;
+	if (!tableGenerated)
+	{
+		memset(sixBitByte, 0xFF, sizeof(sixBitByte));
+		for (BYTE i = 0; i < 0x40; i++)
+			sixBitByte[kDiskByte62[i]] = i;
+		tableGenerated = true;
+	}
+
+	// undo the running xor: a good checksum (the last nibble) leaves 0
+	BYTE value[kFastDiskDataNibbles - 1];
+	BYTE sum = 0;
+	for (int i = 0; i < kFastDiskDataNibbles; i++)
+	{
+		const BYTE sixBits = sixBitByte[FastDiskNibble(floppy, offset + i)];
+		if (sixBits == 0xFF)
+			return false;
+
+		sum ^= sixBits;
+		if (i < kFastDiskDataNibbles - 1)
+			value[i] = sum;
+	}
+
+	if (sum)
+		return false;
+
+	// 86 values of 3 (bit-swapped) low bit-pairs, for bytes i, i+86 & i+172 - then the 256 high 6-bits
+	for (int i = 0; i < 256; i++)
+	{
+		const BYTE bits = (value[i % 86] >> ((i / 86) * 2)) & 3;
+		data[i] = (value[86 + i] << 2) | ((bits & 1) << 1) | (bits >> 1);
+	}
+
+	return true;
+}
+
+static void FastDiskEncodeSector(FloppyDisk& floppy, const int offset, const BYTE* data)
+{
+	BYTE value[kFastDiskDataNibbles - 1] = {0};
+	for (int i = 0; i < 256; i++)
+	{
+		const BYTE bits = ((data[i] & 1) << 1) | ((data[i] >> 1) & 1);
+		value[i % 86] |= bits << ((i / 86) * 2);
+		value[86 + i] = data[i] >> 2;
+	}
+
+	BYTE previous = 0;
+	for (int i = 0; i < kFastDiskDataNibbles; i++)
+	{
+		const BYTE sixBits = (i < kFastDiskDataNibbles - 1) ? value[i] : 0;
+		floppy.m_trackimage[(offset + i) % floppy.m_nibbles] = kDiskByte62[sixBits ^ previous];
+		previous = sixBits;
+	}
+}
+
+// The slot's 16-sector boot PROM is what the 6502 is running
+bool Disk2InterfaceCard::IsFastDiskFirmware(void)
+{
+	return !m_is13SectorFirmware && IsGuestCode(0xC000 | (m_slot << 8), m_16SectorFirmware, DISK2_FW_SIZE);
+}
+
+// Move the current drive's head to where a completed seek leaves it
+void Disk2InterfaceCard::FastDiskSeek(const int phase)
+{
+	FloppyDrive& drive = m_floppyDrive[m_currDrive];
+
+	if (m_deferredStepperEvent)
+	{
+		if (m_syncEvent.m_active)
+			g_SynchronousEventMgr.Remove(m_syncEvent.m_id);
+		m_deferredStepperEvent = false;
+	}
+
+	drive.m_phase = phase;
+	if (drive.m_phasePrecise != (float)phase)
+	{
+		FlushCurrentTrack(m_currDrive);
+		drive.m_phasePrecise = (float)phase;
+		drive.m_disk.m_trackimagedata = false;
+		m_formatTrack.DriveNotWritingTrack();
+		GetFrame().FrameDrawDiskStatus();
+	}
+
+	drive.m_lastStepperCycle = g_nCumulativeCycles;
+}
+
+// Returns the offset of the sector's data field (after its D5 AA AD prologue) in the current drive's track, or -1
+int Disk2InterfaceCard::FastDiskFindSector(const int track, const int sector, BYTE& volume, ULONG uExecutedCycles)
+{
+	FloppyDisk& floppy = m_floppyDrive[m_currDrive].m_disk;
+	if (!floppy.m_imagehandle || ImageIsWOZ(floppy.m_imagehandle))
+		return -1;
+
+	if (!floppy.m_trackimagedata)
+		ReadTrack(m_currDrive, uExecutedCycles);
+
+	if (!floppy.m_trackimagedata || floppy.m_nibbles <= 0)
+		return -1;
+
+	for (int i = 0; i < floppy.m_nibbles; i++)
+	{
+		if (FastDiskNibble(floppy, i) != 0xD5 || FastDiskNibble(floppy, i + 1) != 0xAA || FastDiskNibble(floppy, i + 2) != 0x96)
+			continue;
+
+		BYTE field[4];	// 4&4: volume, track, sector, checksum
+		for (int j = 0; j < 4; j++)
+			field[j] = ((FastDiskNibble(floppy, i + 3 + j * 2) << 1) | 1) & FastDiskNibble(floppy, i + 4 + j * 2);
+
+		if (field[1] != track || field[2] != sector || (field[0] ^ field[1] ^ field[2]) != field[3])
+			continue;
+
+		// RWTS only waits 32 nibbles (after the address field's DE AA) for the data field
+		const int dataSearch = i + 3 + 8 + 2;
+		for (int j = dataSearch; j < dataSearch + 32; j++)
+		{
+			if (FastDiskNibble(floppy, j) == 0xD5 && FastDiskNibble(floppy, j + 1) == 0xAA)
+			{
+				if (FastDiskNibble(floppy, j + 2) != 0xAD)
+					break;
+
+				volume = field[0];
+				return (j + 3) % floppy.m_nibbles;
+			}
+		}
+	}
+
+	return -1;
+}
+
+// The head has just passed the data field at 'offset', and the 6502 is stalled while 'sectors' data fields pass under it
+void Disk2InterfaceCard::FastDiskSpin(FloppyDisk& floppy, const int offset, const UINT sectors)
+{
+	floppy.m_byte = (offset + kFastDiskDataNibbles) % floppy.m_nibbles;
+	CpuStall(sectors * kFastDiskSectorCycles);
+	m_diskLastCycle = g_nCumulativeCycles + sectors * kFastDiskSectorCycles;	// so ReadWrite() doesn't spin the disk through the stall again
+}
+
+// Boot PROM $Cn3B-$Cn51: step the head back 80 phases (~1.6s), leaving it on track 0 with phase 0 on
+bool Disk2InterfaceCard::FastDiskRecalibrate(WORD pc, ULONG uExecutedCycles)
+{
+	if (!m_floppyMotorOn || ImageIsWOZ(m_floppyDrive[m_currDrive].m_disk.m_imagehandle) || !IsFastDiskFirmware())
+		return false;
+
+	FastDiskSeek(0);
+	m_magnetStates = 1 << 0;
+
+	// resume at $Cn52 with A=0 (as left by WAIT)
+	regs.x = m_slot << 4;
+	regs.y = 0xFF;
+	regs.pc = (pc & 0xFF00) | 0x52;
+	return true;
+}
+
+// Boot PROM $Cn5C-$CnEA: read sector $3D of the track under the head (which must be track $41) into ($26)
+bool Disk2InterfaceCard::FastDiskReadBootSector(WORD pc, ULONG uExecutedCycles)
+{
+	// $Cn5D: PHP pushed C=0 when searching for the address field (C=1 for the data field)
+	const BYTE pushedP = ReadByteFromMemory(0x100 | ((regs.sp + 1) & 0xFF));
+	if ((pushedP & AF_CARRY) || !m_floppyMotorOn || !IsFastDiskFirmware())
+		return false;
+
+	FloppyDisk& floppy = m_floppyDrive[m_currDrive].m_disk;
+	const BYTE track = ReadByteFromMemory(0x41);
+	BYTE volume;
+	BYTE data[256];
+	const int offset = FastDiskFindSector(track, ReadByteFromMemory(0x3D), volume, uExecutedCycles);
+	if (offset < 0 || !FastDiskDecodeSector(floppy, offset, data))
+		return false;
+
+	const WORD buffer = ReadWordFromMemory(0x26);
+	for (UINT i = 0; i < 256; i++)
+		WriteByteToMemory(buffer + i, data[i]);
+	WriteByteToMemory(0x40, track);
+
+	FastDiskSpin(floppy, offset, 1);
+
+	// resume at $CnEB (next sector) with the PHP undone
+	regs.sp = 0x100 | ((regs.sp + 1) & 0xFF);
+	regs.y = 0;
+	regs.pc = (pc & 0xFF00) | 0xEB;
+	return true;
+}
+
+// DOS 3.3 RWTS: seek (0), read (1) or write (2) a sector for the IOB at ($48)
+// . resumes at RWTS's exit, $BE46 (C=0) or $BE48 (C=1) which stores A (the return code) in the IOB
+// . RWTS's own state (current track, last drive/slot, RDADR's results) is left as it would be
+bool Disk2InterfaceCard::FastDiskRWTS(WORD pc, WORD addr, ULONG uExecutedCycles, BYTE& result)
+{
+	if (!IsGuestCode(kRWTSEntry, kRWTSEntryCode, sizeof(kRWTSEntryCode))
+		|| !IsGuestCode(kRWTSExit, kRWTSExitCode, sizeof(kRWTSExitCode))
+		|| !IsGuestCode(kRWTSSeek, kRWTSSeekCode, sizeof(kRWTSSeekCode)))
+		return false;
+
+	const WORD iob = ReadWordFromMemory(0x48);
+	const BYTE slot16 = ReadByteFromMemory(iob + 1);
+	const BYTE driveNum = ReadByteFromMemory(iob + 2);
+	const BYTE expectedVolume = ReadByteFromMemory(iob + 3);
+	const BYTE track = ReadByteFromMemory(iob + 4);
+	const BYTE sector = ReadByteFromMemory(iob + 5);
+	const WORD dct = ReadWordFromMemory(iob + 6);
+	const WORD buffer = ReadWordFromMemory(iob + 8);
+	const BYTE command = ReadByteFromMemory(iob + 12);
+
+	// format (4) is left to RWTS, as are DCTs for drives other than the Disk II (2 phases per track)
+	if (slot16 != (addr & 0x70) || (driveNum != 1 && driveNum != 2) || command > 2
+		|| track >= 40 || sector >= 16 || !(ReadByteFromMemory(dct + 1) & 1))
+		return false;
+
+	const int drive = driveNum - 1;
+	FloppyDisk& floppy = m_floppyDrive[drive].m_disk;
+	if (!IsDriveConnected(drive) || (floppy.m_imagehandle && ImageIsWOZ(floppy.m_imagehandle)))
+		return false;
+	if (command != 0 && !floppy.m_imagehandle)
+		return false;
+
+	// drive select, motor on & seek (any fall back from here is still consistent, as RWTS finds itself on the right track)
+	Enable(pc, 0xC08A + drive, 0, 0, uExecutedCycles);
+	ControlMotor(pc, 0xC089, 0, 0, uExecutedCycles);
+	FastDiskSeek(track * 2);
+	m_magnetStates = 0;
+
+	const BYTE slot = slot16 >> 4;
+	const BYTE drives = (drive == DRIVE_1 ? 0x80 : 0x00) | (ReadByteFromMemory(0x35) >> 1);	// ROR $35
+	WriteByteToMemory(0x35, drives);
+	WriteByteToMemory((drive == DRIVE_1 ? 0x0478 : 0x04F8) + slot, track * 2);
+	WriteByteToMemory(0x0478, track);
+	WriteByteToMemory(0x2A, track * 2);
+	WriteByteToMemory(0x2B, slot16);
+	WriteByteToMemory(0x05F8, slot16);
+	WriteByteToMemory(iob + 16, driveNum);
+	for (UINT i = 6; i < 10; i++)
+		WriteByteToMemory(0x36 + i, ReadByteFromMemory(iob + i));	// $3C: DCT, $3E: buffer
+
+	result = 0;
+
+	if (command != 0)
+	{
+		const BYTE physical = ReadByteFromMemory(0xBFB8 + sector);	// RWTS's logical to physical sector table
+		BYTE volume;
+		const int offset = FastDiskFindSector(track, physical, volume, uExecutedCycles);
+		if (offset < 0)
+			return false;
+
+		WriteByteToMemory(0x2C, volume ^ track ^ physical);
+		WriteByteToMemory(0x2D, physical);
+		WriteByteToMemory(0x2E, track);
+		WriteByteToMemory(0x2F, volume);
+		WriteByteToMemory(iob + 14, volume);
+
+		if (expectedVolume && expectedVolume != volume)
+		{
+			result = 0x20;	// volume mismatch
+		}
+		else if (command == 1)
+		{
+			BYTE data[256];
+			if (!FastDiskDecodeSector(floppy, offset, data))
+				return false;
+
+			for (UINT i = 0; i < 256; i++)
+				WriteByteToMemory(buffer + i, data[i]);
+			WriteByteToMemory(0x26, 0);
+		}
+		else if (floppy.m_bWriteProtected)
+		{
+			result = 0x10;	// write protected
+		}
+		else
+		{
+			BYTE data[256];
+			for (UINT i = 0; i < 256; i++)
+				data[i] = ReadByteFromMemory(buffer + i);
+
+			FastDiskEncodeSector(floppy, offset, data);
+			floppy.m_trackimagedirty = true;
+			m_floppyDrive[drive].m_writelight = WRITELIGHT_CYCLES;
+			CpuUpdateDue();
+			GetFrame().FrameDrawDiskLEDS();
+		}
+
+		FastDiskSpin(floppy, offset, 1);
+	}
+
+	regs.pc = result ? 0xBE48 : 0xBE46;
+	return true;
+}
+
+// ProDOS boot block $0986: read block ($46) - ie. 2 sectors of track ($41) - into ($26), for the loader of the PRODOS file
+// . resumes at $09B8 (motor off, then RTS with C=0, as left by $099E: ASL)
+bool Disk2InterfaceCard::FastDiskReadProDOSBootBlock(WORD pc, ULONG uExecutedCycles)
+{
+	if (!IsGuestCode(kProDOSBootCode, kProDOSBootCodeBytes, sizeof(kProDOSBootCodeBytes)))
+		return false;
+
+	FloppyDisk& floppy = m_floppyDrive[m_currDrive].m_disk;
+	const BYTE track = ReadByteFromMemory(0x41);
+	const BYTE sector = ReadByteFromMemory(0x3D);
+	if (!floppy.m_imagehandle || ImageIsWOZ(floppy.m_imagehandle) || track >= 40)
+		return false;
+
+	// motor on & seek (any fall back from here is still consistent, as $09BC finds itself on the right track)
+	ControlMotor(pc, 0xC089, 0, 0, uExecutedCycles);
+	if (ReadByteFromMemory(0x40) != track)
+	{
+		FastDiskSeek(track * 2);
+		m_magnetStates = 1 << ((track * 2) & 3);	// the seek leaves the last phase on
+		WriteByteToMemory(0x40, track);
+	}
+
+	BYTE data[2][256];
+	int offset = -1;
+	for (UINT i = 0; i < 2; i++)
+	{
+		BYTE volume;
+		offset = FastDiskFindSector(track, sector + i * 2, volume, uExecutedCycles);
+		if (offset < 0 || !FastDiskDecodeSector(floppy, offset, data[i]))
+			return false;
+	}
+
+	const WORD buffer = ReadWordFromMemory(0x26);
+	for (UINT i = 0; i < 2 * 256; i++)
+		WriteByteToMemory(buffer + i, data[i / 256][i % 256]);
+
+	// the seek's ($50, $53: current phase) and the sector reads' state
+	WriteByteToMemory(0x50, track * 2);
+	WriteByteToMemory(0x53, track * 2);
+	WriteByteToMemory(0x54, 0);
+	WriteByteToMemory(0x27, (buffer >> 8) + 1);
+	WriteByteToMemory(0x3D, sector + 2);
+
+	FastDiskSpin(floppy, offset, 2);
+
+	regs.pc = kProDOSBootReadBlock + 0x32;
+	return true;
+}
+
+// ProDOS block driver: read (1) or write (2) block ($46) of unit ($43) from/to ($44)
+// . resumes at the driver's caller (the MLI), with A=0 & C=0, or A=$2B & C=1 (write protected) - as a block driver returns
+// . status (0) and format (3) are left to the driver
+// . the head is put back on the track it was on, so the driver's own current track for the drive still holds
+bool Disk2InterfaceCard::FastDiskProDOSDriver(WORD pc, ULONG uExecutedCycles, BYTE& result)
+{
+	const BYTE command = ReadByteFromMemory(0x42);
+	const BYTE unit = ReadByteFromMemory(0x43);
+	const WORD block = ReadWordFromMemory(0x46);
+	if (ReadByteFromMemory(kProDOSGlobalPage) != 0x4C || (command != 1 && command != 2)
+		|| ((unit >> 4) & 7) != m_slot || block >= 40 * 8)
+		return false;
+
+	const WORD entry = ReadWordFromMemory(kProDOSDevAdr + ((unit >> 3) & 0x1E));
+	if ((WORD)(pc - entry) >= 0x800)	// not in the unit's driver
+		return false;
+
+	bool pushedP;
+	const WORD stack = FindProDOSDriverCall(entry, pushedP);
+	if (!stack)
+		return false;
+
+	const int drive = unit >> 7;
+	FloppyDisk& floppy = m_floppyDrive[drive].m_disk;
+	if (!IsDriveConnected(drive) || !floppy.m_imagehandle || ImageIsWOZ(floppy.m_imagehandle))
+		return false;
+
+	// drive select, motor on & seek - and back, if falling back to the driver
+	Enable(pc, 0xC08A + drive, 0, 0, uExecutedCycles);
+	ControlMotor(pc, 0xC089, 0, 0, uExecutedCycles);
+	const int phase = m_floppyDrive[drive].m_phase;
+	const WORD magnetStates = m_magnetStates;
+
+	const int track = block >> 3;
+	const int sector = ((block & 3) << 2) | ((block >> 2) & 1);	// physical sectors 4n/4n+2 (n: block & 3, +1 for blocks 4-7)
+	FastDiskSeek(track * 2);
+
+	int offset[2];
+	BYTE data[2][256];
+	bool found = true;
+	for (UINT i = 0; i < 2 && found; i++)
+	{
+		BYTE volume;
+		offset[i] = FastDiskFindSector(track, sector + i * 2, volume, uExecutedCycles);
+		found = offset[i] >= 0 && (command != 1 || FastDiskDecodeSector(floppy, offset[i], data[i]));
+	}
+
+	result = 0;
+
+	if (found && command == 1)
+	{
+		const WORD buffer = ReadWordFromMemory(0x44);
+		for (UINT i = 0; i < 2 * 256; i++)
+			WriteByteToMemory(buffer + i, data[i / 256][i % 256]);
+		FastDiskSpin(floppy, offset[1], 2);
+	}
+	else if (found && floppy.m_bWriteProtected)
+	{
+		result = 0x2B;	// write protected
+	}
+	else if (found)
+	{
+		const WORD buffer = ReadWordFromMemory(0x44);
+		for (UINT i = 0; i < 2 * 256; i++)
+			data[i / 256][i % 256] = ReadByteFromMemory(buffer + i);
+
+		for (UINT i = 0; i < 2; i++)
+			FastDiskEncodeSector(floppy, offset[i], data[i]);
+		floppy.m_trackimagedirty = true;
+		m_floppyDrive[drive].m_writelight = WRITELIGHT_CYCLES;
+		CpuUpdateDue();
+		GetFrame().FrameDrawDiskLEDS();
+		FastDiskSpin(floppy, offset[1], 2);
+	}
+
+	FastDiskSeek(phase);
+	m_magnetStates = magnetStates;
+
+	if (!found)	// a sector is missing or doesn't decode
+		return false;
+
+	// RTS from the driver (having undone any PHP)
+	if (pushedP)
+		regs.ps = ReadByteFromMemory(0x100 | ((regs.sp + 1) & 0xFF)) | AF_RESERVED | AF_BREAK;
+	regs.ps &= ~(AF_SIGN | AF_ZERO | AF_CARRY);
+	regs.ps |= result ? AF_CARRY : AF_ZERO;
+	regs.a = result;
+	regs.sp = 0x100 | ((stack + 1) & 0xFF);
+	regs.pc = (ReadByteFromMemory(stack) | (ReadByteFromMemory(regs.sp) << 8)) + 1;
+	return true;
+}
+
+bool Disk2InterfaceCard::FastDiskIORead(WORD pc, WORD addr, ULONG uExecutedCycles, BYTE& result)
+{
+	if (pc == m_fastDiskFailedPC)
+		return false;
+
+	const WORD firmware = 0xC000 | (m_slot << 8);
+	result = 0;
+
+	// $Cn47: LDA $C081,X - the recalibrate's 1st step
+	if ((addr & 0xF) == 0x1 && pc == firmware + 0x4A && regs.y == 0x50)
+		return FastDiskRecalibrate(pc, uExecutedCycles);
+
+	// $Cn5E: LDA $C08C,X - the sector read's 1st latch read
+	if ((addr & 0xF) == 0xC && pc == firmware + 0x61)
+	{
+		if (FastDiskReadBootSector(pc, uExecutedCycles))
+			return true;
+
+		m_fastDiskFailedPC = pc;	// else it'd be retried for every latch read of the loop
+		return false;
+	}
+
+	// $BD34: LDA $C08E,X
+	if ((addr & 0xF) == 0xE && pc == kRWTSEntry + 0x37)
+		return FastDiskRWTS(pc, addr, uExecutedCycles, result);
+
+	// $09A7: LDA $C089,X - the ProDOS boot block's block read, motor on
+	if ((addr & 0xF) == 0x9 && pc == kProDOSBootReadBlock + 0x24)
+		return FastDiskReadProDOSBootBlock(pc, uExecutedCycles);
+
+	// LDA $C089,X - a ProDOS block driver's motor on
+	if ((addr & 0xF) == 0x9)
+		return FastDiskProDOSDriver(pc, uExecutedCycles, result);
+
+	return false;
+}
+
+//===========================================================================
+
 BYTE __stdcall Disk2InterfaceCard::IORead(WORD pc, WORD addr, BYTE bWrite, BYTE d, ULONG nExecutedCycles)
 {
 	CpuCalcCycles(nExecutedCycles);	// g_nCumulativeCycles needed by most Disk I/O functions
@@ -2127,6 +2819,15 @@ BYTE __stdcall Disk2InterfaceCard::IORead(WORD pc, WORD addr, BYTE bWrite, BYTE
 
 	pCard->SetSequencerFunction(addr, nExecutedCycles);
 
+	if (pCard->m_fastDisk && g_nAppMode != MODE_STEPPING)	// (so the debugger can step through the 6502 code)
+	{
+		BYTE result;
+		if (pCard->FastDiskIORead(pc, addr, nExecutedCycles, result))
+			return result;
+
+		isWOZ = ImageIsWOZ(pCard->m_floppyDrive[pCard->m_currDrive].m_disk.m_imagehandle);	// Drive may've changed
+	}
+
 	switch (addr & 0xF)
 	{
 	case 0x0:	pCard->ControlStepper(pc, addr, bWrite, d, nExecutedCycles); break;
@@ -2334,10 +3035,28 @@ bool Disk2InterfaceCard::LoadSnapshotFloppy(YamlLoadHelper& yamlLoadHelper, UINT
 	const std::string simpleFilename = yamlLoadHelper.LoadString(SS_YAML_KEY_FILENAME);
 	const std::string absolutePath = version >= 9 ? yamlLoadHelper.LoadString(SS_YAML_KEY_ABSOLUTE_PATH) : "";
 
+	// The same disk in the same drive (eg. libretro's rewind & run-ahead): keep it, rather than eject it & re-open & re-read its image
+	FloppyDisk& floppy = m_floppyDrive[unit].m_disk;
+	const bool bSameDisk = floppy.m_imagehandle && !simpleFilename.empty()
+		&& simpleFilename == floppy.m_fullname && absolutePath == ImageGetPathname(floppy.m_imagehandle);
+
+	if (bSameDisk)
+	{
+		FlushCurrentTrack(unit);	// as EjectDisk()
+		floppy.clearTrack();		// as InsertDisk(), but keep the track buffer
+	}
+	else
+	{
+		EjectDisk(unit);	// Remove any disk & update Registry to reflect empty drive
+		floppy.clear();
+	}
+
+	m_floppyDrive[unit].clearMechanism();	// NB. after the track is flushed, as that uses the drive's phase
+
 	std::string filename = simpleFilename;
 	bool bImageError = filename.empty();
 
-	if (!bImageError)
+	if (!bImageError && !bSameDisk)
 	{
 		DWORD dwAttributes = GetFileAttributes(filename.c_str());
 		if (dwAttributes == INVALID_FILE_ATTRIBUTES && !absolutePath.empty())
@@ -2470,7 +3189,8 @@ void Disk2InterfaceCard::LoadSnapshotDriveUnit(YamlLoadHelper& yamlLoadHelper, U
 		if ((m_floppyDrive[unit].m_disk.m_trackimage == NULL) && m_floppyDrive[unit].m_disk.m_nibbles)
 			AllocTrack(unit, track.size());
 
-		if (m_floppyDrive[unit].m_disk.m_trackimage == NULL)
+		// NB. a kept disk keeps its track buffer, but without a track it's the same as a just inserted disk (see LoadSnapshotFloppy())
+		if (m_floppyDrive[unit].m_disk.m_trackimage == NULL || !m_floppyDrive[unit].m_disk.m_nibbles)
 			bImageError = true;
 		else
 			memcpy(m_floppyDrive[unit].m_disk.m_trackimage, &track[0], track.size());
@@ -2489,6 +3209,11 @@ bool Disk2InterfaceCard::LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT versi
 	if (version < 1 || version > kUNIT_VERSION)
 		ThrowErrorInvalidVersion(version);
 
+	// A kept card (see Snapshot_LoadState_v2()) still has its sync event & sequencer state
+	if (m_syncEvent.m_active)
+		g_SynchronousEventMgr.Remove(m_syncEvent.m_id);
+	ResetLogicStateSequencer();
+
 	m_currDrive = yamlLoadHelper.LoadUint(SS_YAML_KEY_CURRENT_DRIVE);
 	m_magnetStates		= yamlLoadHelper.LoadUint(SS_YAML_KEY_PHASES);
 	m_enhanceDisk		= yamlLoadHelper.LoadBool(SS_YAML_KEY_ENHANCE_DISK);
@@ -2539,12 +3264,8 @@ bool Disk2InterfaceCard::LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT versi
 		m_deferredStepperCumulativeCycles = yamlLoadHelper.LoadUint64(SS_YAML_KEY_DEFERRED_STEPPER_CYCLE);
 	}
 
-	// Eject all disks first in case Drive-2 contains disk to be inserted into Drive-1
-	for (UINT i=0; i<NUM_DRIVES; i++)
-	{
-		EjectDisk(i);	// Remove any disk & update Registry to reflect empty drive
-		m_floppyDrive[i].clear();
-	}
+	// NB. each drive's disk is ejected (or kept) by LoadSnapshotFloppy()
+	// . InsertDisk() ejects the other drive's disk if it's the one being inserted, eg. when Drive-2 contains the disk to be inserted into Drive-1
 
 	LoadSnapshotDriveUnit(yamlLoadHelper, DRIVE_1, version);
 	LoadSnapshotDriveUnit(yamlLoadHelper, DRIVE_2, version);
@@ -59,14 +59,20 @@ public:
 		m_strFilenameInZip.clear();
 		m_imagehandle = NULL;
 		m_bWriteProtected = false;
+		m_trackimage = NULL;
 		//
+		clearTrack();
+	}
+
+	// Just the disk's position & track state, not its image (or its track buffer)
+	void clearTrack()
+	{
 		m_byte = 0;
 		m_nibbles = 0;
 		m_bitOffset = 0;
 		m_bitCount = 0;
 		m_bitMask = 1 << 7;
 		m_extraCycles = 0.0;
-		m_trackimage = NULL;
 		m_trackimagedata = false;
 		m_trackimagedirty = false;
 		m_longestSyncFFRunLength = 0;
@@ -107,6 +113,13 @@ public:
 	~FloppyDrive(){}
 
 	void clear()
+	{
+		clearMechanism();
+		m_disk.clear();
+	}
+
+	// Just the drive, not its disk
+	void clearMechanism()
 	{
 		m_isConnected = true;
 		m_phasePrecise = 0;
@@ -116,7 +129,6 @@ public:
 		m_headWindow = 0;
 		m_spinning = 0;
 		m_writelight = 0;
-		m_disk.clear();
 	}
 
 public:
@@ -141,6 +153,7 @@ public:
 
 	virtual void InitializeIO(LPBYTE pCxRomPeripheral);
 	virtual void Update(const ULONG nExecutedCycles);
+	virtual ULONG GetCyclesUntilUpdate(void);
 
 	virtual void Destroy(void);		// no, doesn't "destroy" the disk image.  DiskIIManagerShutdown()
 
@@ -194,6 +207,8 @@ public:
 
 	bool GetEnhanceDisk(void);
 	void SetEnhanceDisk(bool bEnhanceDisk);
+	bool GetFastDisk(void);
+	void SetFastDisk(bool bFastDisk);
 
 	static BYTE __stdcall IORead(WORD pc, WORD addr, BYTE bWrite, BYTE d, ULONG nExecutedCycles);
 	static BYTE __stdcall IOWrite(WORD pc, WORD addr, BYTE bWrite, BYTE d, ULONG nExecutedCycles);
@@ -213,6 +228,7 @@ private:
 	void UpdateBitStreamOffsets(FloppyDisk& floppy);
 	__forceinline void IncBitStream(FloppyDisk& floppy);
 	void DataLatchReadWOZ(WORD pc, WORD addr, UINT bitCellRemainder);
+	__forceinline bool ReadBitCells4WOZ(FloppyDrive& drive, FloppyDisk& floppy, UINT& outputBits);
 	void DataLoadWriteWOZ(WORD pc, WORD addr, UINT bitCellRemainder);
 	void DataShiftWriteWOZ(WORD pc, WORD addr, ULONG uExecutedCycles);
 	void SetSequencerFunction(WORD addr, ULONG executedCycles);
@@ -226,6 +242,17 @@ private:
 	void ControlStepperDeferred(void);
 	void ControlStepperLogging(WORD address, unsigned __int64 cumulativeCycles);
 
+	bool FastDiskIORead(WORD pc, WORD addr, ULONG uExecutedCycles, BYTE& result);
+	bool FastDiskRecalibrate(WORD pc, ULONG uExecutedCycles);
+	bool FastDiskReadBootSector(WORD pc, ULONG uExecutedCycles);
+	bool FastDiskRWTS(WORD pc, WORD addr, ULONG uExecutedCycles, BYTE& result);
+	bool FastDiskReadProDOSBootBlock(WORD pc, ULONG uExecutedCycles);
+	bool FastDiskProDOSDriver(WORD pc, ULONG uExecutedCycles, BYTE& result);
+	bool IsFastDiskFirmware(void);
+	void FastDiskSeek(const int phase);
+	int FastDiskFindSector(const int track, const int sector, BYTE& volume, ULONG uExecutedCycles);
+	void FastDiskSpin(FloppyDisk& floppy, const int offset, const UINT sectors);
+
 	void PreJitterCheck(int phase, BYTE latch);
 	void AddJitter(int phase, FloppyDisk& floppy);
 	void AddTrackSeamJitter(float phasePrecise, FloppyDisk& floppy);
@@ -272,6 +299,8 @@ private:
 	unsigned __int64 m_diskLastReadLatchCycle;
 	FormatTrack m_formatTrack;
 	bool m_enhanceDisk;
+	bool m_fastDisk;			// Not persisted to the save-state
+	WORD m_fastDiskFailedPC;	// Don't retry a boot PROM loop that couldn't be accelerated
 
 	static const UINT SPINNING_CYCLES = 1000*1000;		// 1M cycles = ~1.000s
 	static const UINT WRITELIGHT_CYCLES = 1000*1000;	// 1M cycles = ~1.000s
@@ -94,6 +94,30 @@ void Disk2CardManager::SetEnhanceDisk(bool enhanceDisk)
 	}
 }
 
+bool Disk2CardManager::GetFastDisk(void)
+{
+	for (UINT i = 0; i < NUM_SLOTS; i++)
+	{
+		if (GetCardMgr().QuerySlot(i) == CT_Disk2)
+		{
+			// All Disk2 cards should have the same setting, so just return the state of the first card
+			return dynamic_cast<Disk2InterfaceCard&>(GetCardMgr().GetRef(i)).GetFastDisk();
+		}
+	}
+	return false;
+}
+
+void Disk2CardManager::SetFastDisk(bool fastDisk)
+{
+	for (UINT i = 0; i < NUM_SLOTS; i++)
+	{
+		if (GetCardMgr().QuerySlot(i) == CT_Disk2)
+		{
+			dynamic_cast<Disk2InterfaceCard&>(GetCardMgr().GetRef(i)).SetFastDisk(fastDisk);
+		}
+	}
+}
+
 void Disk2CardManager::LoadLastDiskImage(void)
 {
 	for (UINT i = 0; i < NUM_SLOTS; i++)
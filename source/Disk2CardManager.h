@@ -11,6 +11,8 @@ public:
 	void Reset(const bool powerCycle = false);
 	bool GetEnhanceDisk(void);
 	void SetEnhanceDisk(bool enhanceDisk);
+	bool GetFastDisk(void);
+	void SetFastDisk(bool fastDisk);
 	void LoadLastDiskImage(void);
 	bool IsAnyFirmware13Sector(void);
 	void GetFilenameAndPathForSaveState(std::string& filename, std::string& path);
@@ -110,6 +110,8 @@ BOOL ImageBoot(ImageInfo* const pImageInfo)
 {
 	BOOL result = 0;
 
+	pImageInfo->pImageHelper->CheckMappedImage(pImageInfo);
+
 	if (pImageInfo->pImageType->AllowBoot())
 		result = pImageInfo->pImageType->Boot(pImageInfo);
 
@@ -134,6 +136,8 @@ void ImageReadTrack(	ImageInfo* const pImageInfo,
 
 	const UINT track = pImageInfo->pImageType->PhaseToTrack(phase);
 
+	pImageInfo->pImageHelper->CheckMappedImage(pImageInfo);
+
 	if (pImageInfo->pImageType->AllowRW())
 	{
 		pImageInfo->pImageType->Read(pImageInfo, phase, pTrackImageBuffer, pNibbles, pBitCount, enhanceDisk);
@@ -159,6 +163,8 @@ void ImageWriteTrack(	ImageInfo* const pImageInfo,
 
 	const UINT track = pImageInfo->pImageType->PhaseToTrack(phase);
 
+	pImageInfo->pImageHelper->CheckMappedImage(pImageInfo);
+
 	if (pImageInfo->pImageType->AllowRW() && !pImageInfo->bWriteProtected)
 	{
 		pImageInfo->pImageType->Write(pImageInfo, phase, pTrackImageBuffer, nNibbles);
@@ -179,6 +185,8 @@ bool ImageReadBlock(	ImageInfo* const pImageInfo,
 						UINT nBlock,
 						LPBYTE pBlockBuffer)
 {
+	pImageInfo->pImageHelper->CheckMappedImage(pImageInfo);
+
 	bool bRes = false;
 	if (pImageInfo->pImageType->AllowRW())
 		bRes = pImageInfo->pImageType->Read(pImageInfo, nBlock, pBlockBuffer);
@@ -192,6 +200,8 @@ bool ImageWriteBlock(	ImageInfo* const pImageInfo,
 						UINT nBlock,
 						LPBYTE pBlockBuffer)
 {
+	pImageInfo->pImageHelper->CheckMappedImage(pImageInfo);
+
 	bool bRes = false;
 	if (pImageInfo->pImageType->AllowRW() && !pImageInfo->bWriteProtected)
 		bRes = pImageInfo->pImageType->Write(pImageInfo, nBlock, pBlockBuffer);
@@ -201,6 +211,43 @@ bool ImageWriteBlock(	ImageInfo* const pImageInfo,
 
 //===========================================================================
 
+// Only normal (uncompressed) images are cached: gzip/zip images are already held in memory
+void ImageSetBlockCache(ImageInfo* const pImageInfo, const bool enable)
+{
+	if (!pImageInfo)
+		return;
+
+	if (enable && !pImageInfo->pBlockCache && pImageInfo->FileType == eFileNormal)
+	{
+		pImageInfo->pBlockCache = new CBlockCache;
+	}
+	else if (!enable && pImageInfo->pBlockCache)
+	{
+		pImageInfo->pBlockCache->Flush(pImageInfo);
+		delete pImageInfo->pBlockCache;
+		pImageInfo->pBlockCache = NULL;
+	}
+}
+
+bool ImageFlushBlockCache(ImageInfo* const pImageInfo)
+{
+	if (!pImageInfo || !pImageInfo->pBlockCache)
+		return true;
+
+	return pImageInfo->pBlockCache->Flush(pImageInfo);
+}
+
+// Has a write-back of cached blocks failed (since the last call)?
+bool ImageTakeBlockCacheWriteError(ImageInfo* const pImageInfo)
+{
+	if (!pImageInfo || !pImageInfo->pBlockCache)
+		return false;
+
+	return pImageInfo->pBlockCache->TakeWriteError();
+}
+
+//===========================================================================
+
 UINT ImageGetNumTracks(ImageInfo* const pImageInfo)
 {
 	return pImageInfo ? pImageInfo->uNumTracks : 0;
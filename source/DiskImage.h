@@ -86,6 +86,9 @@ void ImageReadTrack(ImageInfo* const pImageInfo, float phase, LPBYTE pTrackImage
 void ImageWriteTrack(ImageInfo* const pImageInfo, float phase, LPBYTE pTrackImageBuffer, int nNibbles);
 bool ImageReadBlock(ImageInfo* const pImageInfo, UINT nBlock, LPBYTE pBlockBuffer);
 bool ImageWriteBlock(ImageInfo* const pImageInfo, UINT nBlock, LPBYTE pBlockBuffer);
+void ImageSetBlockCache(ImageInfo* const pImageInfo, const bool enable);
+bool ImageFlushBlockCache(ImageInfo* const pImageInfo);
+bool ImageTakeBlockCacheWriteError(ImageInfo* const pImageInfo);
 
 UINT ImageGetNumTracks(ImageInfo* const pImageInfo);
 bool ImageIsMultiFileZip(ImageInfo* const pImageInfo);
@@ -58,10 +58,41 @@ ImageInfo::ImageInfo()
 	uNumValidImagesInZip = 0;
 	uNumTracks = 0;
 	pImageBuffer = NULL;
+	bImageBufferMapped = false;
+	uImageBufferMappedSize = 0;
 	pWOZTrackMap = NULL;
 	optimalBitTiming = 0;
 	bootSectorFormat = CWOZHelper::bootUnknown;
 	maxNibblesPerTrack = 0;
+	pBlockCache = NULL;
+}
+
+// Map a normal file instead of reading it: pages are only read when first accessed (eg. just the header
+// of a HDD image), and the OS's page cache is shared by all the processes which have the image open
+// . write-protected: read-only view of the file
+// . writable: private copy-on-write view, since writes also go through to the file with WriteImageData()
+static BYTE* MapImageFile(HANDLE hFile, const bool bWriteProtected)
+{
+	// NB. Returns NULL on failure (not INVALID_HANDLE_VALUE)
+	HANDLE hMapping = CreateFileMapping(hFile, NULL, bWriteProtected ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, NULL);
+	if (hMapping == NULL)
+		return NULL;
+
+	BYTE* pView = (BYTE*) MapViewOfFile(hMapping, bWriteProtected ? FILE_MAP_READ : FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(hMapping);	// the view keeps the mapping open
+	return pView;
+}
+
+static void FreeImageBuffer(ImageInfo* pImageInfo)
+{
+	if (pImageInfo->bImageBufferMapped)
+		UnmapViewOfFile(pImageInfo->pImageBuffer);
+	else
+		delete [] pImageInfo->pImageBuffer;
+
+	pImageInfo->pImageBuffer = NULL;
+	pImageInfo->bImageBufferMapped = false;
+	pImageInfo->uImageBufferMappedSize = 0;
 }
 
 CImageBase::CImageBase()
@@ -138,6 +169,18 @@ bool CImageBase::ReadBlock(ImageInfo* pImageInfo, const int nBlock, LPBYTE pBloc
 
 	if (pImageInfo->FileType == eFileNormal)
 	{
+		if (pImageInfo->pImageBuffer)	// write-protected image, mapped by CheckNormalFile()
+		{
+			if ((UINT)Offset + HD_BLOCK_SIZE > pImageInfo->uImageSize)
+				return false;
+
+			memcpy(pBlockBuffer, &pImageInfo->pImageBuffer[Offset], HD_BLOCK_SIZE);
+			return true;
+		}
+
+		if (pImageInfo->pBlockCache)
+			return pImageInfo->pBlockCache->ReadBlock(pImageInfo, nBlock, pBlockBuffer);
+
 		if (pImageInfo->hFile == INVALID_HANDLE_VALUE)
 			return false;
 
@@ -187,7 +230,11 @@ bool CImageBase::WriteBlock(ImageInfo* pImageInfo, const int nBlock, LPBYTE pBlo
 		memcpy(&pImageInfo->pImageBuffer[offset], pBlockBuffer, HD_BLOCK_SIZE);
 	}
 
-	if (!WriteImageData(pImageInfo, pBlockBuffer, HD_BLOCK_SIZE, offset))
+	const bool bRes = (pImageInfo->FileType == eFileNormal && pImageInfo->pBlockCache)
+		? pImageInfo->pBlockCache->WriteBlock(pImageInfo, nBlock, pBlockBuffer)
+		: WriteImageData(pImageInfo, pBlockBuffer, HD_BLOCK_SIZE, offset);
+
+	if (!bRes)
 	{
 		_ASSERT(0);
 		return false;
@@ -295,6 +342,235 @@ bool CImageBase::WriteImageData(ImageInfo* pImageInfo, LPBYTE pSrcBuffer, const
 
 //-----------------------------------------------------------------------------
 
+bool CBlockCache::ReadBlock(ImageInfo* pImageInfo, const UINT nBlock, LPBYTE pBlockBuffer)
+{
+	const UINT nExtent = nBlock / kBlocksPerExtent;
+	const UINT32 bit = 1u << (nBlock % kBlocksPerExtent);
+
+	std::map<UINT, Extent>::iterator it = m_extents.find(nExtent);
+	if (it == m_extents.end() || (!it->second.loaded && !(it->second.valid & bit)))
+	{
+		if (!Load(pImageInfo, nExtent))
+			return false;
+		it = m_extents.find(nExtent);
+	}
+
+	Extent& extent = it->second;
+	if (!(extent.valid & bit))
+		return false;	// beyond the end of the image
+
+	Touch(extent);
+	memcpy(pBlockBuffer, &extent.data[(nBlock % kBlocksPerExtent) * HD_BLOCK_SIZE], HD_BLOCK_SIZE);
+	return true;
+}
+
+// NB. only fails if this block can't be cached: a failure to write back an older block is for TakeWriteError()
+bool CBlockCache::WriteBlock(ImageInfo* pImageInfo, const UINT nBlock, const BYTE* pBlockBuffer)
+{
+	const UINT nExtent = nBlock / kBlocksPerExtent;
+	const UINT32 bit = 1u << (nBlock % kBlocksPerExtent);
+
+	if (m_extents.find(nExtent) == m_extents.end())
+		MakeRoom(pImageInfo, 1);
+
+	Extent& extent = GetExtent(nExtent);
+	memcpy(&extent.data[(nBlock % kBlocksPerExtent) * HD_BLOCK_SIZE], pBlockBuffer, HD_BLOCK_SIZE);
+	extent.valid |= bit;
+	extent.dirty |= bit;
+	Touch(extent);
+	return true;
+}
+
+bool CBlockCache::Flush(ImageInfo* pImageInfo)
+{
+	bool bRes = true;
+	m_runNumBlocks = 0;
+
+	// extents are ordered by block number, so a run can span several of them
+	for (std::map<UINT, Extent>::iterator it = m_extents.begin(); it != m_extents.end(); ++it)
+	{
+		if (it->second.dirty)
+			bRes = FlushExtent(pImageInfo, it->first, it->second) && bRes;
+	}
+
+	return WriteRun(pImageInfo) && bRes;
+}
+
+bool CBlockCache::IsDirty(void) const
+{
+	for (std::map<UINT, Extent>::const_iterator it = m_extents.begin(); it != m_extents.end(); ++it)
+	{
+		if (it->second.dirty)
+			return true;
+	}
+
+	return false;
+}
+
+bool CBlockCache::TakeWriteError(void)
+{
+	const bool writeError = m_writeError;
+	m_writeError = false;
+	return writeError;
+}
+
+CBlockCache::Extent& CBlockCache::GetExtent(const UINT nExtent)
+{
+	Extent& extent = m_extents[nExtent];
+	if (extent.data.empty())
+	{
+		extent.data.resize(kBlocksPerExtent * HD_BLOCK_SIZE);
+		extent.lru = m_lru.insert(m_lru.begin(), nExtent);
+	}
+	return extent;
+}
+
+void CBlockCache::Touch(Extent& extent)
+{
+	m_lru.splice(m_lru.begin(), m_lru, extent.lru);
+}
+
+bool CBlockCache::Load(ImageInfo* pImageInfo, const UINT nExtent)
+{
+	if (pImageInfo->hFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	const UINT extentSize = kBlocksPerExtent * HD_BLOCK_SIZE;
+
+	// Sequential misses: also read the following extents, up to the first one already loaded
+	UINT numExtents = 1;
+	if (nExtent == m_lastMissExtent + 1)
+	{
+		while (numExtents < kReadAheadExtents && pImageInfo->uOffset + (nExtent + numExtents) * extentSize < pImageInfo->uImageSize)
+		{
+			std::map<UINT, Extent>::const_iterator it = m_extents.find(nExtent + numExtents);
+			if (it != m_extents.end() && it->second.loaded)
+				break;
+			numExtents++;
+		}
+	}
+	m_lastMissExtent = nExtent + numExtents - 1;
+
+	// NB. evict first, so the extents being loaded aren't evicted
+	// - if a write-back fails, the cache just stays over-full (see MakeRoom())
+	MakeRoom(pImageInfo, numExtents);
+
+	const long offset = pImageInfo->uOffset + nExtent * extentSize;
+	if (SetFilePointer(pImageInfo->hFile, offset, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
+		return false;
+
+	// NB. ignore ReadFile()'s result, as a short read at the end of the image is expected
+	// - the blocks after it stay non-valid
+	m_ioBuffer.resize(numExtents * extentSize);
+	DWORD dwBytesRead = 0;
+	ReadFile(pImageInfo->hFile, &m_ioBuffer[0], m_ioBuffer.size(), &dwBytesRead, NULL);
+
+	const UINT numBlocksRead = dwBytesRead / HD_BLOCK_SIZE;
+	for (UINT i = 0; i < numExtents; i++)
+	{
+		Extent& extent = GetExtent(nExtent + i);
+		for (UINT b = 0; b < kBlocksPerExtent && i * kBlocksPerExtent + b < numBlocksRead; b++)
+		{
+			if (extent.valid & (1u << b))
+				continue;	// already cached (and possibly dirty)
+
+			memcpy(&extent.data[b * HD_BLOCK_SIZE], &m_ioBuffer[(i * kBlocksPerExtent + b) * HD_BLOCK_SIZE], HD_BLOCK_SIZE);
+			extent.valid |= 1u << b;
+		}
+		extent.loaded = true;
+		Touch(extent);
+	}
+
+	m_ioBuffer.clear();
+	return true;
+}
+
+// Evict least recently used extents, writing back their dirty blocks
+// . an extent whose write-back fails stays resident (and dirty), so the cache can be left over-full rather than lose the blocks
+bool CBlockCache::MakeRoom(ImageInfo* pImageInfo, const UINT numExtents)
+{
+	bool bRes = true;
+
+	std::list<UINT>::iterator next = m_lru.end();
+	while (next != m_lru.begin() && m_extents.size() + numExtents > kMaxExtents)
+	{
+		std::list<UINT>::iterator pos = --next;
+		std::map<UINT, Extent>::iterator lru = m_extents.find(*pos);
+
+		if (lru->second.dirty)
+		{
+			m_runNumBlocks = 0;
+			bRes = FlushExtent(pImageInfo, lru->first, lru->second) && bRes;
+			bRes = WriteRun(pImageInfo) && bRes;
+			if (lru->second.dirty)
+				continue;
+		}
+
+		next = m_lru.erase(pos);
+		m_extents.erase(lru);
+	}
+
+	return bRes;
+}
+
+// Append the extent's dirty blocks to the current run, writing the run out whenever it is broken
+bool CBlockCache::FlushExtent(ImageInfo* pImageInfo, const UINT nExtent, const Extent& extent)
+{
+	bool bRes = true;
+
+	for (UINT b = 0; b < kBlocksPerExtent; b++)
+	{
+		if (!(extent.dirty & (1u << b)))
+			continue;
+
+		const UINT nBlock = nExtent * kBlocksPerExtent + b;
+		if (m_runNumBlocks && m_runFirstBlock + m_runNumBlocks != nBlock)
+			bRes = WriteRun(pImageInfo) && bRes;
+
+		if (!m_runNumBlocks)
+			m_runFirstBlock = nBlock;
+
+		const BYTE* pBlock = &extent.data[b * HD_BLOCK_SIZE];
+		m_ioBuffer.insert(m_ioBuffer.end(), pBlock, pBlock + HD_BLOCK_SIZE);
+		m_runNumBlocks++;
+	}
+
+	return bRes;
+}
+
+// Write the run, and only then clear its blocks' dirty bits
+bool CBlockCache::WriteRun(ImageInfo* pImageInfo)
+{
+	if (!m_runNumBlocks)
+		return true;
+
+	bool bRes = false;
+	const long offset = pImageInfo->uOffset + m_runFirstBlock * HD_BLOCK_SIZE;
+	if (pImageInfo->hFile != INVALID_HANDLE_VALUE && SetFilePointer(pImageInfo->hFile, offset, NULL, FILE_BEGIN) != INVALID_SET_FILE_POINTER)
+	{
+		DWORD dwBytesWritten = 0;
+		bRes = WriteFile(pImageInfo->hFile, &m_ioBuffer[0], m_ioBuffer.size(), &dwBytesWritten, NULL) && dwBytesWritten == m_ioBuffer.size();
+	}
+
+	if (bRes)
+	{
+		for (UINT nBlock = m_runFirstBlock; nBlock < m_runFirstBlock + m_runNumBlocks; nBlock++)
+			m_extents[nBlock / kBlocksPerExtent].dirty &= ~(1u << (nBlock % kBlocksPerExtent));
+	}
+	else
+	{
+		if (!m_writeError)
+			LogFileOutput("HDD block cache: failed to write back blocks %04X-%04X to: %s\n", m_runFirstBlock, m_runFirstBlock + m_runNumBlocks - 1, pImageInfo->szFilename.c_str());
+		m_writeError = true;	// the blocks stay dirty
+	}
+
+	m_ioBuffer.clear();
+	m_runNumBlocks = 0;
+	return bRes;
+}
+
+//-----------------------------------------------------------------------------
+
 LPBYTE CImageBase::Code62(int sector)
 {
 	// CONVERT THE 256 8-BIT BYTES INTO 342 6-BIT BYTES, WHICH WE STORE
@@ -583,6 +859,43 @@ void CImageBase::SkewTrack(const int nTrack, const int nNumNibbles, const LPBYTE
 
 //-------------------------------------
 
+// Seek-heavy software keeps stepping between the same few tracks: only nibblize a track the first time it's read
+void CImageBase::ReadNibblizedTrack(ImageInfo* pImageInfo, const UINT nTrack, SectorOrder_e SectorOrder, LPBYTE pTrackImageBuffer, int* pNibbles, bool enhanceDisk)
+{
+	if (nTrack >= pImageInfo->nibblizedTracks.size())
+		pImageInfo->nibblizedTracks.resize(nTrack + 1, NibblizedTrack_t());
+
+	NibblizedTrack_t& cached = pImageInfo->nibblizedTracks[nTrack];
+	if (cached.nNibbles && cached.sectorOrder == SectorOrder && cached.volumeNumber == m_uVolumeNumber && cached.enhanceDisk == enhanceDisk)
+	{
+		memcpy(pTrackImageBuffer, &cached.nibbles[0], cached.nNibbles);
+		*pNibbles = cached.nNibbles;
+		return;
+	}
+
+	ReadTrack(pImageInfo, nTrack, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
+	*pNibbles = NibblizeTrack(pTrackImageBuffer, SectorOrder, nTrack);
+	if (!enhanceDisk)
+		SkewTrack(nTrack, *pNibbles, pTrackImageBuffer);
+
+	cached.nNibbles = *pNibbles;
+	cached.sectorOrder = (BYTE)SectorOrder;
+	cached.volumeNumber = m_uVolumeNumber;
+	cached.enhanceDisk = enhanceDisk;
+	cached.nibbles.assign(pTrackImageBuffer, pTrackImageBuffer + *pNibbles);
+}
+
+void CImageBase::WriteDenibblizedTrack(ImageInfo* pImageInfo, const UINT nTrack, SectorOrder_e SectorOrder, LPBYTE pTrackImageBuffer, int nNibbles)
+{
+	if (nTrack < pImageInfo->nibblizedTracks.size())
+		pImageInfo->nibblizedTracks[nTrack].nNibbles = 0;
+
+	DenibblizeTrack(pTrackImageBuffer, SectorOrder, nNibbles);
+	WriteTrack(pImageInfo, nTrack, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
+}
+
+//-------------------------------------
+
 bool CImageBase::IsValidImageSize(const DWORD uImageSize)
 {
 	m_uNumTracksInImage = 0;
@@ -660,17 +973,13 @@ public:
 	virtual void Read(ImageInfo* pImageInfo, const float phase, LPBYTE pTrackImageBuffer, int* pNibbles, UINT* pBitCount, bool enhanceDisk)
 	{
 		const UINT track = PhaseToTrack(phase);
-		ReadTrack(pImageInfo, track, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
-		*pNibbles = NibblizeTrack(pTrackImageBuffer, eDOSOrder, track);
-		if (!enhanceDisk)
-			SkewTrack(track, *pNibbles, pTrackImageBuffer);
+		ReadNibblizedTrack(pImageInfo, track, eDOSOrder, pTrackImageBuffer, pNibbles, enhanceDisk);
 	}
 
 	virtual void Write(ImageInfo* pImageInfo, const float phase, LPBYTE pTrackImageBuffer, int nNibbles)
 	{
 		const UINT track = PhaseToTrack(phase);
-		DenibblizeTrack(pTrackImageBuffer, eDOSOrder, nNibbles);
-		WriteTrack(pImageInfo, track, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
+		WriteDenibblizedTrack(pImageInfo, track, eDOSOrder, pTrackImageBuffer, nNibbles);
 	}
 
 	virtual bool AllowCreate(void) { return true; }
@@ -728,17 +1037,13 @@ public:
 	virtual void Read(ImageInfo* pImageInfo, const float phase, LPBYTE pTrackImageBuffer, int* pNibbles, UINT* pBitCount, bool enhanceDisk)
 	{
 		const UINT track = PhaseToTrack(phase);
-		ReadTrack(pImageInfo, track, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
-		*pNibbles = NibblizeTrack(pTrackImageBuffer, eProDOSOrder, track);
-		if (!enhanceDisk)
-			SkewTrack(track, *pNibbles, pTrackImageBuffer);
+		ReadNibblizedTrack(pImageInfo, track, eProDOSOrder, pTrackImageBuffer, pNibbles, enhanceDisk);
 	}
 
 	virtual void Write(ImageInfo* pImageInfo, const float phase, LPBYTE pTrackImageBuffer, int nNibbles)
 	{
 		const UINT track = PhaseToTrack(phase);
-		DenibblizeTrack(pTrackImageBuffer, eProDOSOrder, nNibbles);
-		WriteTrack(pImageInfo, track, m_pWorkBuffer, TRACK_DENIBBLIZED_SIZE);
+		WriteDenibblizedTrack(pImageInfo, track, eProDOSOrder, pTrackImageBuffer, nNibbles);
 	}
 
 	virtual eImageType GetType(void) { return eImagePO; }
@@ -1000,17 +1305,18 @@ public:
 		DWORD bytesread;
 		ReadFile(ptr->hFile, &address, sizeof(WORD), &bytesread, NULL);
 		ReadFile(ptr->hFile, &length , sizeof(WORD), &bytesread, NULL);
-		if ((((WORD)(address+length)) <= address) ||
+		if ((length == 0) ||	// NB. &buffer[0] below needs a non-empty buffer
+			(((WORD)(address+length)) <= address) ||
 			(address >= 0xC000) ||
 			(address+length-1 >= 0xC000))
 		{
 			return false;
 		}
 
-		ReadFile(ptr->hFile, mem+address, length, &bytesread, NULL);
-		int loop = 192;
-		while (loop--)
-			*(memdirty+loop) = 0xFF;
+		std::vector<BYTE> buffer(length);
+		ReadFile(ptr->hFile, &buffer[0], length, &bytesread, NULL);
+		for (WORD i = 0; i < length; i++)
+			WriteByteToMemory(address + i, buffer[i]);
 
 		regs.pc = address;
 		return true;
@@ -1053,7 +1359,8 @@ public:
 		ReadFile(pImageInfo->hFile, &length , sizeof(WORD), &bytesread, NULL);
 
 		length <<= 1;
-		if ((((WORD)(address+length)) <= address) ||
+		if ((length == 0) ||	// NB. &buffer[0] below needs a non-empty buffer
+			(((WORD)(address+length)) <= address) ||
 			(address >= 0xC000) ||
 			(address+length-1 >= 0xC000))
 		{
@@ -1061,11 +1368,10 @@ public:
 		}
 
 		SetFilePointer(pImageInfo->hFile,128,NULL,FILE_BEGIN);
-		ReadFile(pImageInfo->hFile, mem+address, length, &bytesread, NULL);
-
-		int loop = 192;
-		while (loop--)
-			*(memdirty+loop) = 0xFF;
+		std::vector<BYTE> buffer(length);
+		ReadFile(pImageInfo->hFile, &buffer[0], length, &bytesread, NULL);
+		for (WORD i = 0; i < length; i++)
+			WriteByteToMemory(address + i, buffer[i]);
 
 		regs.pc = address;
 		return true;
@@ -1197,7 +1503,7 @@ public:
 
 			// NB. delete old pImageBuffer: pWOZTrackMap updated in WOZUpdateInfo() by parent function
 
-			delete [] pImageInfo->pImageBuffer;
+			FreeImageBuffer(pImageInfo);
 			pTrackMap = NULL;	// invalidate
 			pImageInfo->pImageBuffer = pNewImageBuffer;
 			pImageInfo->uImageSize = newImageSize;
@@ -1324,7 +1630,7 @@ public:
 
 			// NB. delete old pImageBuffer: pWOZTrackMap updated in WOZUpdateInfo() by parent function
 
-			delete [] pImageInfo->pImageBuffer;
+			FreeImageBuffer(pImageInfo);
 			pTrackMap = NULL;	// invalidate
 			pImageInfo->pImageBuffer = pNewImageBuffer;
 			pImageInfo->uImageSize = newImageSize;
@@ -1841,23 +2147,31 @@ ImageError_e CImageHelperBase::CheckNormalFile(LPCTSTR pszImageFilename, ImageIn
 		bool bTempDetectBuffer;
 		const UINT uDetectSize = GetMinDetectSize(dwSize, &bTempDetectBuffer);
 
-		pImageInfo->pImageBuffer = new BYTE [dwSize];
+		pImageInfo->pImageBuffer = MapImageFile(hFile, pImageInfo->bWriteProtected);
+		pImageInfo->bImageBufferMapped = (pImageInfo->pImageBuffer != NULL);
+		pImageInfo->uImageBufferMappedSize = pImageInfo->bImageBufferMapped ? dwSize : 0;
 
-		DWORD dwBytesRead;
-		BOOL bRes = ReadFile(hFile, pImageInfo->pImageBuffer, dwSize, &dwBytesRead, NULL);
-		if (!bRes || dwSize != dwBytesRead)
+		if (!pImageInfo->bImageBufferMapped)
 		{
-			delete [] pImageInfo->pImageBuffer;
-			pImageInfo->pImageBuffer = NULL;
-			return eIMAGE_ERROR_BAD_SIZE;
+			pImageInfo->pImageBuffer = new BYTE [dwSize];
+
+			DWORD dwBytesRead;
+			BOOL bRes = ReadFile(hFile, pImageInfo->pImageBuffer, dwSize, &dwBytesRead, NULL);
+			if (!bRes || dwSize != dwBytesRead)
+			{
+				delete [] pImageInfo->pImageBuffer;
+				pImageInfo->pImageBuffer = NULL;
+				return eIMAGE_ERROR_BAD_SIZE;
+			}
 		}
 
+		const bool bWasWriteProtected = pImageInfo->bWriteProtected;
 		pImageType = Detect(pImageInfo->pImageBuffer, dwSize, szExt, dwOffset, pImageInfo);
-		if (bTempDetectBuffer)
-		{
-			delete [] pImageInfo->pImageBuffer;
-			pImageInfo->pImageBuffer = NULL;
-		}
+
+		// A read-only view costs no memory, so keep it for ReadBlock()
+		// NB. a writable view is never kept, as WriteBlock() only writes to the file
+		if (bTempDetectBuffer && !(pImageInfo->bImageBufferMapped && bWasWriteProtected))
+			FreeImageBuffer(pImageInfo);
 	}
 	else	// Create (or pre-existing zero-length file)
 	{
@@ -1974,6 +2288,13 @@ ImageError_e CImageHelperBase::Open(	LPCTSTR pszImageFilename,
 
 void CImageHelperBase::Close(ImageInfo* pImageInfo)
 {
+	if (pImageInfo->pBlockCache)
+	{
+		pImageInfo->pBlockCache->Flush(pImageInfo);
+		delete pImageInfo->pBlockCache;
+		pImageInfo->pBlockCache = NULL;
+	}
+
 	if (pImageInfo->hFile != INVALID_HANDLE_VALUE)
 	{
 		CloseHandle(pImageInfo->hFile);
@@ -1982,8 +2303,35 @@ void CImageHelperBase::Close(ImageInfo* pImageInfo)
 
 	pImageInfo->szFilename.clear();
 
-	delete [] pImageInfo->pImageBuffer;
-	pImageInfo->pImageBuffer = NULL;
+	FreeImageBuffer(pImageInfo);
+}
+
+// Called before each track/block access
+// . if another process has truncated the file, then touching the view beyond the new end would fault (SIGBUS on Linux),
+//   so switch to an in-memory copy of what is left (the rest reads as zeros), like an image that couldn't be mapped
+// . NB. a file that is replaced (ie. renamed over) is harmless: the view still has the old file
+void CImageHelperBase::CheckMappedImage(ImageInfo* pImageInfo)
+{
+	if (!pImageInfo->bImageBufferMapped || pImageInfo->hFile == INVALID_HANDLE_VALUE)
+		return;
+
+	const DWORD dwSize = GetFileSize(pImageInfo->hFile, NULL);
+	if (dwSize != INVALID_FILE_SIZE && dwSize >= pImageInfo->uImageBufferMappedSize)
+		return;
+
+	const UINT uSize = pImageInfo->uImageBufferMappedSize;
+	const UINT uValidSize = (dwSize != INVALID_FILE_SIZE) ? dwSize : 0;
+	LogFileOutput("Disk image truncated (%08X -> %08X bytes) by another process: %s\n", uSize, uValidSize, pImageInfo->szFilename.c_str());
+
+	BYTE* pBuffer = new BYTE[uSize];
+	memcpy(pBuffer, pImageInfo->pImageBuffer, uValidSize);
+	memset(pBuffer + uValidSize, 0, uSize - uValidSize);
+
+	const ptrdiff_t wozTrackMapOffset = pImageInfo->pWOZTrackMap ? pImageInfo->pWOZTrackMap - pImageInfo->pImageBuffer : 0;
+	FreeImageBuffer(pImageInfo);
+	pImageInfo->pImageBuffer = pBuffer;
+	if (pImageInfo->pWOZTrackMap)
+		pImageInfo->pWOZTrackMap = pBuffer + wozTrackMapOffset;
 }
 
 //-------------------------------------
@@ -4,6 +4,8 @@
 #include "DiskImage.h"
 #include "minizip/zip.h"
 
+#include <list>
+
 #define GZ_SUFFIX ".gz"
 #define GZ_SUFFIX_LEN (sizeof(GZ_SUFFIX)-1)
 
@@ -19,6 +21,71 @@ class CImageHelperBase;
 
 enum FileType_e {eFileNormal, eFileGZip, eFileZip};
 
+// DO/PO only: a track as returned by CImageBase::ReadNibblizedTrack()
+struct NibblizedTrack_t
+{
+	int				nNibbles;			// 0 = not cached
+	BYTE			sectorOrder;
+	BYTE			volumeNumber;
+	bool			enhanceDisk;		// if false, then the track is skewed
+	std::vector<BYTE> nibbles;
+
+	NibblizedTrack_t() : nNibbles(0), sectorOrder(0), volumeNumber(0), enhanceDisk(false) {}
+};
+
+// Normal (uncompressed) HDD images only: optional write-back cache of 512-byte blocks
+// . a miss reads a whole extent with a single ReadFile (and reads ahead if the misses are sequential)
+// . writes stay in memory until Flush(), which coalesces adjacent dirty blocks into single WriteFile calls
+// . the least recently used extent is written back and dropped when the cache is full
+// . blocks whose write-back fails stay dirty (and their extent resident), and the failure is latched for TakeWriteError()
+class CBlockCache
+{
+public:
+	CBlockCache(void) : m_lastMissExtent(UINT_MAX), m_runFirstBlock(0), m_runNumBlocks(0), m_writeError(false) {}
+
+	bool ReadBlock(ImageInfo* pImageInfo, const UINT nBlock, LPBYTE pBlockBuffer);
+	bool WriteBlock(ImageInfo* pImageInfo, const UINT nBlock, const BYTE* pBlockBuffer);
+	bool Flush(ImageInfo* pImageInfo);
+	bool IsDirty(void) const;
+	bool TakeWriteError(void);
+
+private:
+	enum
+	{
+		kBlocksPerExtent = 32,		// 16KB extents
+		kMaxExtents = 64,			// 1MB
+		kReadAheadExtents = 4,		// 64KB
+	};
+
+	struct Extent
+	{
+		bool	loaded;				// non-valid blocks are beyond the end of the image
+		UINT32	valid;				// bit per block
+		UINT32	dirty;				// bit per block (dirty => valid)
+		std::list<UINT>::iterator lru;	// position in m_lru
+		std::vector<BYTE> data;
+
+		Extent(void) : loaded(false), valid(0), dirty(0) {}
+	};
+
+	Extent& GetExtent(const UINT nExtent);
+	void Touch(Extent& extent);
+	bool Load(ImageInfo* pImageInfo, const UINT nExtent);
+	bool MakeRoom(ImageInfo* pImageInfo, const UINT numExtents);
+	bool FlushExtent(ImageInfo* pImageInfo, const UINT nExtent, const Extent& extent);
+	bool WriteRun(ImageInfo* pImageInfo);
+
+	std::map<UINT, Extent> m_extents;
+	std::list<UINT> m_lru;			// extent numbers, most recently used first
+	UINT m_lastMissExtent;
+
+	std::vector<BYTE> m_ioBuffer;	// read-ahead, or a run of dirty blocks being coalesced
+	UINT m_runFirstBlock;
+	UINT m_runNumBlocks;
+
+	bool m_writeError;				// a write-back has failed since the last TakeWriteError()
+};
+
 struct ImageInfo
 {
 	std::string 	szFilename;
@@ -36,10 +103,14 @@ struct ImageInfo
 	// Floppy only
 	UINT			uNumTracks;
 	BYTE*			pImageBuffer;
+	bool			bImageBufferMapped;	// Normal files only: pImageBuffer is a view of hFile (not allocated)
+	UINT			uImageBufferMappedSize;	// size of the view (ie. of the file when it was mapped)
 	BYTE*			pWOZTrackMap;		// WOZ only (points into pImageBuffer)
 	BYTE			optimalBitTiming;	// WOZ only
 	BYTE			bootSectorFormat;	// WOZ only
 	UINT			maxNibblesPerTrack;
+	std::vector<NibblizedTrack_t> nibblizedTracks;	// DO/PO only: indexed by track, invalidated by Write()
+	CBlockCache*	pBlockCache;		// HDD only: NULL unless enabled with ImageSetBlockCache()
 
 	ImageInfo();
 };
@@ -98,6 +169,8 @@ protected:
 	void DenibblizeTrack (LPBYTE trackimage, SectorOrder_e SectorOrder, int nibbles);
 	DWORD NibblizeTrack (LPBYTE trackimagebuffer, SectorOrder_e SectorOrder, int track);
 	void SkewTrack (const int nTrack, const int nNumNibbles, const LPBYTE pTrackImageBuffer);
+	void ReadNibblizedTrack (ImageInfo* pImageInfo, const UINT nTrack, SectorOrder_e SectorOrder, LPBYTE pTrackImageBuffer, int* pNibbles, bool enhanceDisk);
+	void WriteDenibblizedTrack (ImageInfo* pImageInfo, const UINT nTrack, SectorOrder_e SectorOrder, LPBYTE pTrackImageBuffer, int nNibbles);
 
 public:
 	UINT m_uNumTracksInImage;	// Init'd by CDiskImageHelper.Detect()/GetImageForCreation() & possibly updated by IsValidImageSize()
@@ -379,6 +452,7 @@ public:
 	ImageError_e Open(LPCTSTR pszImageFilename, ImageInfo* pImageInfo, const bool bCreateIfNecessary, std::string& strFilenameInZip);
 	void Close(ImageInfo* pImageInfo);
 	bool WOZUpdateInfo(ImageInfo* pImageInfo, DWORD& dwOffset);
+	void CheckMappedImage(ImageInfo* pImageInfo);
 
 	virtual CImageBase* Detect(LPBYTE pImage, DWORD dwSize, const TCHAR* pszExt, DWORD& dwOffset, ImageInfo* pImageInfo) = 0;
 	virtual CImageBase* GetImageForCreation(const TCHAR* pszExt, DWORD* pCreateImageSize) = 0;
@@ -14,6 +14,7 @@ public:
 	virtual void Destroy(void) {}
 	virtual void Reset(const bool powerCycle) {}
 	virtual void Update(const ULONG nExecutedCycles) {}
+	virtual ULONG GetCyclesUntilUpdate(void) { return CYCLES_UNTIL_UPDATE_NONE; }
 
 	virtual void InitializeIO(LPBYTE pCxRomPeripheral);
 
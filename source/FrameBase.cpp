@@ -2,9 +2,143 @@
 
 #include "FrameBase.h"
 #include "Interface.h"
+#include "Memory.h"
 #include "NTSC.h"
 #include "StrFormat.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//===========================================================================
+
+// Renders the full-speed video frames on its own thread
+// . the emulation thread hands over a copy of the video pages & mode, then carries on executing the 6502
+// . the frame is drawn into a 2nd framebuffer, which is copied to the Video framebuffer at the next full-speed redraw
+class VideoRenderThread
+{
+public:
+	VideoRenderThread()
+		: m_bQuit(false)
+		, m_bBusy(false)
+		, m_bFrameReady(false)
+		, m_memMain(64*1024)
+		, m_memAux(64*1024)
+		, m_uVideoMode(0)
+		, m_bAltCharSet(false)
+		, m_dwCyclesThisFrame(0)
+	{
+		m_thread = std::thread(&VideoRenderThread::Run, this);
+	}
+
+	~VideoRenderThread()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cv.wait(lock, [this] { return !m_bBusy; });
+			m_bQuit = true;
+		}
+		m_cv.notify_all();
+		m_thread.join();
+	}
+
+	// Copy the last rendered frame to the Video framebuffer: false if there isn't a new one
+	bool GetFrame(void)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_bBusy)
+			return false;
+
+		NTSC_VideoEndRenderFrame();
+		if (!m_bFrameReady)
+			return false;
+
+		m_bFrameReady = false;
+		if (m_frameBuffer.size() != GetFrameBufferSize())
+			return false;	// the Video framebuffer was re-created since
+
+		memcpy(GetVideo().GetFrameBuffer(), m_frameBuffer.data(), m_frameBuffer.size());
+		NTSC_VideoInvalidateScanlines();	// for the frontends which only upload the dirty scanlines
+		return true;
+	}
+
+	// Hand the current frame over: false if the previous one is still being rendered
+	bool StartFrame(DWORD dwCyclesThisFrame)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_bBusy)
+				return false;
+
+			// Start from the current framebuffer, for the borders
+			m_frameBuffer.resize(GetFrameBufferSize());
+			memcpy(m_frameBuffer.data(), GetVideo().GetFrameBuffer(), m_frameBuffer.size());
+
+			MemCopyVideoPages(m_memMain.data(), m_memAux.data());
+			m_uVideoMode = GetVideo().GetVideoMode();
+			m_bAltCharSet = GetVideo().VideoGetSWAltCharSet();
+			m_dwCyclesThisFrame = dwCyclesThisFrame;
+
+			m_bBusy = true;
+			m_bFrameReady = false;
+			NTSC_VideoBeginRenderFrame();
+		}
+		m_cv.notify_all();
+		return true;
+	}
+
+	// Wait for the frame in flight, and drop it
+	void Discard(void)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait(lock, [this] { return !m_bBusy; });
+		m_bFrameReady = false;
+		NTSC_VideoEndRenderFrame();
+	}
+
+private:
+	static size_t GetFrameBufferSize(void)
+	{
+		return GetVideo().GetFrameBufferWidth() * GetVideo().GetFrameBufferHeight() * sizeof(bgra_t);
+	}
+
+	void Run(void)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_cv.wait(lock, [this] { return m_bBusy || m_bQuit; });
+			if (m_bQuit)
+				break;
+
+			// The emulation thread doesn't touch the buffers while busy
+			lock.unlock();
+			NTSC_VideoRenderFrame(m_frameBuffer.data(), m_memMain.data(), m_memAux.data(), m_uVideoMode, m_bAltCharSet, m_dwCyclesThisFrame);
+			lock.lock();
+
+			m_bBusy = false;
+			m_bFrameReady = true;
+			m_cv.notify_all();
+		}
+	}
+
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	bool m_bQuit;
+	bool m_bBusy;		// frame handed over, but not rendered yet
+	bool m_bFrameReady;
+
+	std::vector<BYTE> m_memMain;
+	std::vector<BYTE> m_memAux;
+	std::vector<uint8_t> m_frameBuffer;
+	uint32_t m_uVideoMode;
+	bool m_bAltCharSet;
+	DWORD m_dwCyclesThisFrame;
+};
+
+//===========================================================================
+
 FrameBase::FrameBase()
 {
 	g_hFrameWindow = (HWND)0;
@@ -43,6 +177,8 @@ void FrameBase::VideoRedrawScreenDuringFullSpeed(DWORD dwCyclesThisFrame, bool b
 	{
 		// Just entered full-speed mode
 		dwFullSpeedStartTime = GetTickCount();
+		if (m_pRenderThread)
+			m_pRenderThread->Discard();	// don't show a frame from a previous full-speed period
 		return;
 	}
 
@@ -52,15 +188,39 @@ void FrameBase::VideoRedrawScreenDuringFullSpeed(DWORD dwCyclesThisFrame, bool b
 
 	dwFullSpeedStartTime += dwFullSpeedDuration;
 
+	if (m_pRenderThread)
+	{
+		// Show the frame rendered since the last time, and start on this one
+		if (m_pRenderThread->GetFrame())
+			VideoPresentScreen();
+		m_pRenderThread->StartFrame(dwCyclesThisFrame);
+		return;
+	}
+
 	VideoRedrawScreenAfterFullSpeed(dwCyclesThisFrame);
 }
 
 void FrameBase::VideoRedrawScreenAfterFullSpeed(DWORD dwCyclesThisFrame)
 {
+	VideoWaitForRenderThread();
 	NTSC_VideoClockResync(dwCyclesThisFrame);
 	VideoRedrawScreen();	// Better (no flicker) than using: NTSC_VideoReinitialize() or VideoReinitialize()
 }
 
+void FrameBase::SetFullSpeedRenderThread(bool bEnable)
+{
+	if (bEnable && !m_pRenderThread)
+		m_pRenderThread = std::make_unique<VideoRenderThread>();
+	else if (!bEnable)
+		m_pRenderThread.reset();
+}
+
+void FrameBase::VideoWaitForRenderThread(void)
+{
+	if (m_pRenderThread)
+		m_pRenderThread->Discard();
+}
+
 void FrameBase::Video_RedrawAndTakeScreenShot(const char* pScreenshotFilename)
 {
 	_ASSERT(pScreenshotFilename);
@@ -2,7 +2,10 @@
 
 #include "Video.h"
 
+#include <memory>
+
 class NetworkBackend;
+class VideoRenderThread;
 
 class FrameBase
 {
@@ -61,6 +64,8 @@ public:
 	void VideoRedrawScreen(void);
 	void VideoRedrawScreenDuringFullSpeed(DWORD dwCyclesThisFrame, bool bInit = false);
 	void VideoRedrawScreenAfterFullSpeed(DWORD dwCyclesThisFrame);
+	void SetFullSpeedRenderThread(bool bEnable);	// render the full-speed frames on another thread, so the 6502 doesn't stall
+	void VideoWaitForRenderThread(void);	// must be called before leaving full-speed
 	void Video_RedrawAndTakeScreenShot(const char* pScreenshotFilename);
 
 	virtual std::string Video_GetScreenShotFolder() const = 0;
@@ -79,6 +84,7 @@ private:
 	bool g_bShowPrintScreenWarningDialog;
 
 	DWORD dwFullSpeedStartTime;
+	std::unique_ptr<VideoRenderThread> m_pRenderThread;
 	bool g_bDisplayPrintScreenFileName;
 
 	int g_nLastScreenShot;
@@ -177,6 +177,10 @@ HarddiskInterfaceCard::HarddiskInterfaceCard(UINT slot) :
 
 	m_saveDiskImage = true;	// Save the DiskImage name to Registry
 
+	m_blockCache = GetRegistryBlockCache(m_slot);
+	m_blockCacheDirty = false;
+	m_blockCacheIdleCycles = 0;
+
 	m_saveStateFirmwareV1 = false;
 	m_saveStateFirmwareV2 = false;
 	m_saveStateFirmwareValid = false;
@@ -199,6 +203,72 @@ void HarddiskInterfaceCard::Reset(const bool powerCycle)
 
 //===========================================================================
 
+// Written blocks are flushed to the image file once the interface has been idle for ~1 second
+static const ULONG kBlockCacheIdleLimit = 1000000;
+
+void HarddiskInterfaceCard::Update(const ULONG nExecutedCycles)
+{
+	if (!m_blockCacheDirty)
+		return;
+
+	if ((m_blockCacheIdleCycles += nExecutedCycles) >= kBlockCacheIdleLimit)
+		FlushBlockCache();
+}
+
+ULONG HarddiskInterfaceCard::GetCyclesUntilUpdate(void)
+{
+	if (!m_blockCacheDirty)
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	return (m_blockCacheIdleCycles < kBlockCacheIdleLimit) ? kBlockCacheIdleLimit - m_blockCacheIdleCycles : 1;
+}
+
+void HarddiskInterfaceCard::SetBlockCache(const bool enable)
+{
+	m_blockCache = enable;
+
+	for (UINT i = 0; i < NUM_HARDDISKS; i++)
+	{
+		if (m_hardDiskDrive[i].m_imageloaded)
+			ImageSetBlockCache(m_hardDiskDrive[i].m_imagehandle, m_blockCache);
+	}
+
+	m_blockCacheDirty = false;	// disabling flushes, enabling starts clean
+}
+
+bool HarddiskInterfaceCard::FlushBlockCache(void)
+{
+	bool bRes = true;
+
+	for (UINT i = 0; i < NUM_HARDDISKS; i++)
+	{
+		if (m_hardDiskDrive[i].m_imageloaded)
+			bRes = ImageFlushBlockCache(m_hardDiskDrive[i].m_imagehandle) && bRes;
+	}
+
+	m_blockCacheDirty = !bRes;	// retry failed write-backs when next idle
+	m_blockCacheIdleCycles = 0;
+	return bRes;
+}
+
+void HarddiskInterfaceCard::SetRegistryBlockCache(UINT slot, const bool enabled)
+{
+	const std::string regSection = RegGetConfigSlotSection(slot);
+	RegSaveValue(regSection.c_str(), REGVALUE_HDD_BLOCK_CACHE, TRUE, enabled);
+}
+
+bool HarddiskInterfaceCard::GetRegistryBlockCache(UINT slot)
+{
+	const std::string regSection = RegGetConfigSlotSection(slot);
+
+	// By default, blocks are written through to the image file
+	DWORD enabled = 0;
+	RegLoadValue(regSection.c_str(), REGVALUE_HDD_BLOCK_CACHE, TRUE, &enabled);
+	return enabled != 0;
+}
+
+//===========================================================================
+
 void HarddiskInterfaceCard::InitializeIO(LPBYTE pCxRomPeripheral)
 {
 	const DWORD HARDDISK_FW_SIZE = APPLE_SLOT_SIZE;
@@ -450,6 +520,7 @@ bool HarddiskInterfaceCard::Insert(const int iDrive, const std::string& pathname
 	{
 		GetImageTitle(pathname.c_str(), m_hardDiskDrive[iDrive].m_imagename, m_hardDiskDrive[iDrive].m_fullname);
 		Snapshot_UpdatePath();
+		ImageSetBlockCache(m_hardDiskDrive[iDrive].m_imagehandle, m_blockCache);
 	}
 
 	SaveLastDiskImage(iDrive);
@@ -667,6 +738,15 @@ BYTE HarddiskInterfaceCard::CmdExecute(HardDiskDrive* pHDD)
 	const UINT PAGE_SIZE = 256;
 
 	pHDD->m_error = DEVICE_OK;
+	m_blockCacheIdleCycles = 0;
+
+	if (ImageTakeBlockCacheWriteError(pHDD->m_imagehandle))
+	{
+		// An earlier write-back of cached blocks failed (they're still cached): report it instead of this command
+		pHDD->m_status_next = DISK_STATUS_OFF;
+		pHDD->m_error = DEVICE_IO_ERROR;
+		return CmdStatus(pHDD);
+	}
 
 	switch (m_command)
 	{
@@ -696,14 +776,13 @@ BYTE HarddiskInterfaceCard::CmdExecute(HardDiskDrive* pHDD)
 				pHDD->m_buf_ptr = 0;
 
 				// Apple II's MMU could be setup so that read & write memory is different,
-				// so can't use 'mem' (like we can for HDD block writes)
+				// so use memwrite (HDD block writes use memread)
 				WORD dstAddr = pHDD->m_memblock;
 				UINT remaining = HD_BLOCK_SIZE;
 				BYTE* pSrc = pHDD->m_buf;
 
 				while (remaining)
 				{
-					memdirty[dstAddr >> 8] = 0xFF;
 					LPBYTE page = memwrite[dstAddr >> 8];
 					if (!page)	// I/O space or ROM
 					{
@@ -762,6 +841,9 @@ BYTE HarddiskInterfaceCard::CmdExecute(HardDiskDrive* pHDD)
 		else
 		{
 			pHDD->m_status_next = DISK_STATUS_WRITE;
+			if (m_blockCache && !m_blockCacheDirty)
+				CpuUpdateDue();	// the idle flush is armed (see GetCyclesUntilUpdate())
+			m_blockCacheDirty = m_blockCache;
 			bool bRes = true;
 			const bool bAppendBlocks = (pHDD->m_diskblock * HD_BLOCK_SIZE) >= ImageGetImageSize(pHDD->m_imagehandle);
 			bool breakpointHit = false;
@@ -808,7 +890,7 @@ BYTE HarddiskInterfaceCard::CmdExecute(HardDiskDrive* pHDD)
 					if (g_nAppMode == MODE_STEPPING)
 						breakpointHit = DebuggerCheckMemBreakpoints(srcAddr, size, false);
 
-					memcpy(pDst, mem + srcAddr, size);
+					memcpy(pDst, MemGetReadPtr(srcAddr), size);	// within a page
 					pDst += size;
 					srcAddr = (srcAddr + size) & (MEMORY_LENGTH - 1);	// wraps at 64KiB boundary
 
@@ -848,6 +930,9 @@ BYTE HarddiskInterfaceCard::CmdExecute(HardDiskDrive* pHDD)
 			const UINT numBlocks = GetImageSizeInBlocks(pHDD->m_imagehandle);
 			memset(pHDD->m_buf, 0, HD_BLOCK_SIZE);
 			bool res = false;
+			if (m_blockCache && !m_blockCacheDirty)
+				CpuUpdateDue();	// the idle flush is armed (see GetCyclesUntilUpdate())
+			m_blockCacheDirty = m_blockCache;
 			m_notBusyCycle = g_nCumulativeCycles;
 
 			for (UINT block = 0; block < numBlocks; block++)
@@ -1035,21 +1120,19 @@ HardDiskDrive* HarddiskInterfaceCard::GetUnit(void)
 
 void HarddiskInterfaceCard::SetIdString(WORD addr, const char* str)
 {
-	BYTE& idStrLen = mem[addr];	// ID string length
-	idStrLen = 0;
+	BYTE idStrLen = 0;	// ID string length
 
 	WORD idStrAddr = addr + 1;
 	for (UINT i = 0; i < 16; i++)
-		mem[idStrAddr + i] = ' ';	// ID string padded with ASCII spaces
-
-	if (str == NULL)
-		return;
+		WriteByteToMemory(idStrAddr + i, ' ');	// ID string padded with ASCII spaces
 
-	while (*str && idStrLen < 16)
+	while (str && *str && idStrLen < 16)
 	{
 		idStrLen++;
-		mem[idStrAddr++] = *str++;
+		WriteByteToMemory(idStrAddr++, *str++);
 	}
+
+	WriteByteToMemory(addr, idStrLen);
 }
 
 BYTE HarddiskInterfaceCard::SmartPortCmdStatus(HardDiskDrive* pHDD)
@@ -1079,19 +1162,19 @@ BYTE HarddiskInterfaceCard::SmartPortCmdStatus(HardDiskDrive* pHDD)
 		case SP_Cmd_status_GETDIB:
 		{
 			// SmartPort driver status (8 bytes)
-			mem[statusListAddr++] = numDevices;
+			WriteByteToMemory(statusListAddr++, numDevices);
 			for (UINT i = 0; i < 7; i++)
-				mem[statusListAddr++] = 0;	// reserved
+				WriteByteToMemory(statusListAddr++, 0);	// reserved
 			if (m_statusCode == SP_Cmd_status_STATUS)
 				break;
 			// Device Information Block (DIB)
 			std::string idStr = "AppleWin SP";
 			SetIdString(statusListAddr, idStr.c_str());
 			statusListAddr += 17;
-			mem[statusListAddr++] = 0x00;	// device type (0x00: Apple II memory expansion card)
-			mem[statusListAddr++] = 0x00;	// device subtype (0x00: Apple II memory expansion card)
-			mem[statusListAddr++] = fwVerMajor;	// f/w version (major)
-			mem[statusListAddr++] = fwVerMinor;	// f/w version (minor)
+			WriteByteToMemory(statusListAddr++, 0x00);	// device type (0x00: Apple II memory expansion card)
+			WriteByteToMemory(statusListAddr++, 0x00);	// device subtype (0x00: Apple II memory expansion card)
+			WriteByteToMemory(statusListAddr++, fwVerMajor);	// f/w version (major)
+			WriteByteToMemory(statusListAddr++, fwVerMinor);	// f/w version (minor)
 			break;
 		}
 		case SP_Cmd_status_GETDCB:
@@ -1117,12 +1200,12 @@ BYTE HarddiskInterfaceCard::SmartPortCmdStatus(HardDiskDrive* pHDD)
 			// . b3=format allowed, b2=media write protected (block devices only), b1=device currently interrupting (//c only), b0=device currently open (char device only)
 			BYTE generalStatus = isImageLoaded ? 0xF8 : 0xE8;			// Loaded: b#11111000: bwrlf--- / Not loaded: b#11101000: bwr-f---
 			if (pHDD->m_bWriteProtected) generalStatus |= (1 << 2);
-			mem[statusListAddr++] = generalStatus;
+			WriteByteToMemory(statusListAddr++, generalStatus);
 
 			const UINT imageSizeInBlocks = isImageLoaded ? GetImageSizeInBlocks(pHDD->m_imagehandle) : 0;
-			mem[statusListAddr++] = imageSizeInBlocks & 0xff;			// num blocks (lo)
-			mem[statusListAddr++] = (imageSizeInBlocks >> 8) & 0xff;	// num blocks (med)
-			mem[statusListAddr++] = (imageSizeInBlocks >> 16) & 0xff;	// num blocks (hi)
+			WriteByteToMemory(statusListAddr++, imageSizeInBlocks & 0xff);			// num blocks (lo)
+			WriteByteToMemory(statusListAddr++, (imageSizeInBlocks >> 8) & 0xff);	// num blocks (med)
+			WriteByteToMemory(statusListAddr++, (imageSizeInBlocks >> 16) & 0xff);	// num blocks (hi)
 
 			if (m_statusCode == SP_Cmd_status_STATUS)
 				break;
@@ -1133,10 +1216,10 @@ BYTE HarddiskInterfaceCard::SmartPortCmdStatus(HardDiskDrive* pHDD)
 			idStr += (char)('0' + m_unitNum % 10);
 			SetIdString(statusListAddr, idStr.c_str());
 			statusListAddr += 17;
-			mem[statusListAddr++] = 0x02;	// device type (0x02: Hard disk)
-			mem[statusListAddr++] = 0x20;	// device subtype (0x20: Hard disk)
-			mem[statusListAddr++] = fwVerMajor;	// f/w version (major)
-			mem[statusListAddr++] = fwVerMinor;	// f/w version (minor)
+			WriteByteToMemory(statusListAddr++, 0x02);	// device type (0x02: Hard disk)
+			WriteByteToMemory(statusListAddr++, 0x20);	// device subtype (0x20: Hard disk)
+			WriteByteToMemory(statusListAddr++, fwVerMajor);	// f/w version (major)
+			WriteByteToMemory(statusListAddr++, fwVerMinor);	// f/w version (minor)
 			break;
 		}
 		case SP_Cmd_status_GETDCB:
@@ -1260,6 +1343,8 @@ void HarddiskInterfaceCard::SaveSnapshotHDDUnit(YamlSaveHelper& yamlSaveHelper,
 
 void HarddiskInterfaceCard::SaveSnapshot(YamlSaveHelper& yamlSaveHelper)
 {
+	FlushBlockCache();	// the save-state refers to the image files, so they must be up to date
+
 	YamlSaveHelper::Slot slot(yamlSaveHelper, GetSnapshotCardName(), m_slot, kUNIT_VERSION);
 
 	YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
@@ -1272,7 +1357,7 @@ void HarddiskInterfaceCard::SaveSnapshot(YamlSaveHelper& yamlSaveHelper)
 	// New label
 	{
 		YamlSaveHelper::Label buffer(yamlSaveHelper, "%s:\n", SS_YAML_KEY_FIRMWARE);
-		yamlSaveHelper.SaveMemory(mem + APPLE_IO_BEGIN + m_slot * APPLE_SLOT_SIZE, APPLE_SLOT_SIZE);
+		yamlSaveHelper.SaveMemory(MemGetReadPtr(APPLE_IO_BEGIN + m_slot * APPLE_SLOT_SIZE), APPLE_SLOT_SIZE);
 	}
 
 	for (UINT i = 0; i < NUM_HARDDISKS; i++)
@@ -1288,16 +1373,27 @@ bool HarddiskInterfaceCard::LoadSnapshotHDDUnit(YamlLoadHelper& yamlLoadHelper,
 
 	std::string hddUnitName = std::string(SS_YAML_KEY_HDDUNIT) + (char)('0' + baseUnitNum + unit);
 	if (!yamlLoadHelper.GetSubMap(hddUnitName))
-		return false;	// No HDD plugged in for this unit#
-
-	m_hardDiskDrive[unit].m_fullname.clear();
-	m_hardDiskDrive[unit].m_imagename.clear();
-	m_hardDiskDrive[unit].m_imageloaded = false;	// Default to false (until image is successfully loaded below)
-	m_hardDiskDrive[unit].m_status_next = DISK_STATUS_OFF;
-	m_hardDiskDrive[unit].m_status_prev = DISK_STATUS_OFF;
+	{
+		Unplug(unit);	// No HDD plugged in for this unit#
+		m_hardDiskDrive[unit].clear();
+		return false;
+	}
 
 	const std::string simpleFilename = yamlLoadHelper.LoadString(SS_YAML_KEY_FILENAME);
 	const std::string absolutePath = version >= 6 ? yamlLoadHelper.LoadString(SS_YAML_KEY_ABSOLUTE_PATH) : "";
+
+	// The same HDD in the same unit (eg. libretro's rewind & run-ahead): keep it, rather than unplug it & re-open its image
+	const bool bSameImage = m_hardDiskDrive[unit].m_imageloaded && !simpleFilename.empty()
+		&& simpleFilename == m_hardDiskDrive[unit].m_fullname && absolutePath == ImageGetPathname(m_hardDiskDrive[unit].m_imagehandle);
+
+	if (!bSameImage)
+	{
+		Unplug(unit);
+		m_hardDiskDrive[unit].clear();	// NB. m_imageloaded is false until the image is successfully loaded below
+	}
+
+	m_hardDiskDrive[unit].m_status_next = DISK_STATUS_OFF;
+	m_hardDiskDrive[unit].m_status_prev = DISK_STATUS_OFF;
 	m_hardDiskDrive[unit].m_error = yamlLoadHelper.LoadUint(SS_YAML_KEY_ERROR);
 	m_hardDiskDrive[unit].m_memblock = yamlLoadHelper.LoadUint(SS_YAML_KEY_MEMBLOCK);
 	m_hardDiskDrive[unit].m_diskblock = yamlLoadHelper.LoadUint(SS_YAML_KEY_DISKBLOCK);
@@ -1320,7 +1416,12 @@ bool HarddiskInterfaceCard::LoadSnapshotHDDUnit(YamlLoadHelper& yamlLoadHelper,
 	bool userSelectedImageFolder = false;
 
 	std::string filename = simpleFilename;
-	if (!filename.empty())
+	if (bSameImage)
+	{
+		m_hardDiskDrive[unit].m_status_next = diskStatusNext;
+		m_hardDiskDrive[unit].m_status_prev = diskStatusPrev;
+	}
+	else if (!filename.empty())
 	{
 		DWORD dwAttributes = GetFileAttributes(filename.c_str());
 		if (dwAttributes == INVALID_FILE_ATTRIBUTES && !absolutePath.empty())
@@ -1406,12 +1507,8 @@ bool HarddiskInterfaceCard::LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT ve
 			m_saveStateFirmwareValid = false;
 	}
 
-	// Unplug all HDDs first in case eg. HDD-2 is to be plugged in as HDD-1
-	for (UINT i = 0; i < NUM_HARDDISKS; i++)
-	{
-		Unplug(i);
-		m_hardDiskDrive[i].clear();
-	}
+	// NB. each HDD is unplugged (or kept) by LoadSnapshotHDDUnit()
+	// . Insert() unplugs the other HDD if it's the one being plugged in, eg. when HDD-2 is to be plugged in as HDD-1
 
 	bool userSelectedImageFolder = false;
 	for (UINT i = 0; i < NUM_HARDDISKS; i++)
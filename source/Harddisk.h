@@ -98,7 +98,8 @@ public:
 	virtual ~HarddiskInterfaceCard(void);
 
 	virtual void Reset(const bool powerCycle);
-	virtual void Update(const ULONG nExecutedCycles) {}
+	virtual void Update(const ULONG nExecutedCycles);
+	virtual ULONG GetCyclesUntilUpdate(void);
 
 	virtual void InitializeIO(LPBYTE pCxRomPeripheral);
 	virtual void Destroy(void);
@@ -113,6 +114,11 @@ public:
 	void UseHdcFirmwareV1(void) { m_useHdcFirmwareV1 = true; }
 	void UseHdcFirmwareV2(void) { m_useHdcFirmwareV2 = true; }
 	void SetHdcFirmwareMode(HdcMode hdcMode) { m_useHdcFirmwareMode = hdcMode; }
+	void SetBlockCache(const bool enable);
+	bool FlushBlockCache(void);
+
+	static void SetRegistryBlockCache(UINT slot, const bool enabled);
+	static bool GetRegistryBlockCache(UINT slot);
 
 	void GetLightStatus(Disk_Status_e* pDisk1Status);
 	bool ImageSwap(void);
@@ -159,6 +165,10 @@ private:
 
 	bool m_saveDiskImage;	// Save the DiskImage name to Registry
 
+	bool m_blockCache;			// Write-back cache for normal (uncompressed) images
+	bool m_blockCacheDirty;		// Blocks written since the last flush
+	ULONG m_blockCacheIdleCycles;	// Cycles since the last command
+
 	HardDiskDrive m_hardDiskDrive[NUM_HARDDISKS];
 	HardDiskDrive m_smartPortController;		// unit-0 is the SmartPort controller
 
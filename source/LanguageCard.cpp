@@ -143,9 +143,6 @@ BYTE __stdcall LanguageCardUnit::IO(WORD PC, WORD uAddr, BYTE bWrite, BYTE uValu
 
 	//
 
-	if (MemOptimizeForModeChanging(PC, uAddr))
-		return bWrite ? 0 : MemReadFloatingBus(nExecutedCycles);
-
 	// IF THE MEMORY PAGING MODE HAS CHANGED, UPDATE OUR MEMORY IMAGES AND
 	// WRITE TABLES.
 	if ((lastmemmode != memmode) || bCardChanged)
@@ -160,13 +157,13 @@ BYTE __stdcall LanguageCardUnit::IO(WORD PC, WORD uAddr, BYTE bWrite, BYTE uValu
 
 bool LanguageCardUnit::IsOpcodeRMWabs(WORD addr)
 {
-	BYTE param1 = mem[(regs.pc - 2) & 0xffff];
-	BYTE param2 = mem[(regs.pc - 1) & 0xffff];
+	BYTE param1 = ReadByteFromMemory((regs.pc - 2) & 0xffff);
+	BYTE param2 = ReadByteFromMemory((regs.pc - 1) & 0xffff);
 	if (param1 != (addr & 0xff) || param2 != 0xC0)
 		return false;
 
 	// GH#404, GH#700: INC $C083,X/C08B,X (RMW) to write enable the LC (any 6502/65C02/816)
-	BYTE opcode = mem[(regs.pc - 3) & 0xffff];
+	BYTE opcode = ReadByteFromMemory((regs.pc - 3) & 0xffff);
 	if (opcode == 0xFE && regs.x == 0)	// INC abs,x
 		return true;
 
@@ -421,9 +418,6 @@ BYTE __stdcall Saturn128K::IO(WORD PC, WORD uAddr, BYTE bWrite, BYTE uValue, ULO
 		}
 	}
 
-	// NB. Saturn can be put in any slot but MemOptimizeForModeChanging() currently only supports LC in slot 0.
-	// . This optimization (check if next opcode is STA $C002-5) isn't essential, so skip it for now.
-
 	// IF THE MEMORY PAGING MODE HAS CHANGED, UPDATE OUR MEMORY IMAGES AND
 	// WRITE TABLES.
 	if ((lastmemmode != memmode) || bBankChanged)
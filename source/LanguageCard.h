@@ -17,6 +17,7 @@ public:
 	virtual void Destroy(void) {}
 	virtual void Reset(const bool powerCycle);
 	virtual void Update(const ULONG nExecutedCycles) {}
+	virtual ULONG GetCyclesUntilUpdate(void) { return CYCLES_UNTIL_UPDATE_NONE; }
 
 	virtual void InitializeIO(LPBYTE pCxRomPeripheral);
 	virtual UINT GetActiveBank(void) { return 0; }	// Always 0 as only 1x 16K bank
@@ -157,51 +157,32 @@ SOFT SWITCH STATUS FLAGS
 // Notes
 // -----
 //
-// memimage
-// - 64KB
-//
-// mem
-// (a pointer to memimage 64KB)
-// - a 64KB r/w memory cache
-// - reflects the current readable memory in the 6502's 64K address space
-//		. excludes $Cxxx I/O memory
-//		. could be a mix of RAM/ROM, main/aux, etc
-// - may also reflect the current writeable memory (on a 256-page granularity) if the write page addr == read page addr
-//		. for this case, the memdirty flag(s) are valid
-//		. when writes instead occur to backing-store, then memdirty flag(s) can be ignored
-//
 // memmain, memaux
 // - physical contiguous 64KB "backing-store" for main & aux respectively
 // - NB. 4K bank1 BSR is at $C000-$CFFF
 //
+// memread
+// - 1 pointer entry per 256-byte page
+// - points directly into the backing-store (or ROM) that the 6502 currently reads for that page
+//		. EG: if ALTZP=1, then:
+//			. memread[0] = &memaux[0x0000]
+//			. memread[1] = &memaux[0x0100]
+//		. $C0xx points to ROM, but the 6502 never reads it (I/O)
+// - so a change of paging mode is only an update of this table: no memory is moved
+//
 // memwrite
 // - 1 pointer entry per 256-byte page
 // - used to write to a page
-// - if RD & WR point to the same 256-byte RAM page, then memwrite will point to the page in 'mem'
-//		. ie. when SW_AUXREAD==SW_AUXWRITE, or 4K-BSR is r/w, or 8K BSR is r/w, or SW_80STORE=1
-//		. So 'mem' remains correct for both r&w operations, but the physical 64K mem block becomes stale
-// - if RD & WR point to different 256-byte pages, then memwrite will point to the page in the physical 64K mem block
-//		. writes will still set the dirty flag (but can be ignored)
-//		. UpdatePaging() ignores this, as it only copies back to the physical 64K mem block when memshadow changes (for that 256-byte page)
-//
-// memdirty
-// - 1 byte entry per 256-byte page
-// - set when a write occurs to a 256-byte page
-// - indicates that 'mem' (ie. the cache) is out-of-sync with the "physical" 64K backing-store memory
-// - NB. a page's dirty flag is only useful(valid) when 'mem' is used for both read & write for the corresponding page
-//   When they differ, then writes go directly to the backing-store.
-//   . In this case, the dirty flag will just force a memcpy() to the same address in backing-store.
+// - points directly into the backing-store (so it is the same as memread when RD & WR select the same 256-byte RAM page)
+// - NULL for ROM and I/O
 //
-// memshadow
-// - 1 pointer entry per 256-byte page
-// - reflects how 'mem' is setup for read operations (at a 256-byte granularity)
-//		. EG: if ALTZP=1, then:
-//			. mem will have copies of memaux's ZP & stack
-//			. memshadow[0] = &memaux[0x0000]
-//			. memshadow[1] = &memaux[0x0100]
+// mem
+// - a 64KB view of the 6502's address space, for code that wants a flat array (eg. debugger memory dumps)
+// - NOT kept up-to-date: only valid after calling MemUpdateView()
+// - writes to it are ignored: use WriteByteToMemory(), or MemGetReadPtr() to patch the bank being read (eg. the debugger)
 //
 
-static LPBYTE  memshadow[0x100];
+LPBYTE         memread[0x100];
 LPBYTE         memwrite[0x100];
 
 iofunction		IORead[256];
@@ -215,7 +196,6 @@ LPBYTE         mem          = NULL;
 static LPBYTE  memaux       = NULL;
 static LPBYTE  memmain      = NULL;
 
-LPBYTE         memdirty     = NULL;
 static LPBYTE  memrom       = NULL;
 
 static LPBYTE  memimage     = NULL;
@@ -226,7 +206,6 @@ static LPBYTE	pCxRomPeripheral	= NULL;
 static LPBYTE g_pMemMainLanguageCard = NULL;
 
 static DWORD   g_memmode = LanguageCardUnit::kMemModeInitialState;
-static BOOL    modechanging = 0;				// An Optimisation: means delay calling UpdatePaging() for 1 instruction
 
 static UINT    memrompages = 1;
 
@@ -757,6 +736,7 @@ inline bool IsPotentialNoSlotClockAccess(const WORD address)
 }
 
 static bool IsCardInSlot(UINT slot);
+static void UpdatePagingC8xx(void);
 
 // Enabling expansion ROM ($C800..$CFFF]:
 // . Enable if: Enable1 && Enable2
@@ -805,7 +785,7 @@ static BYTE __stdcall IO_Cxxx(WORD programcounter, WORD address, BYTE write, BYT
 		{
 			// NB. SW_INTCXROM==1 ensures that internal rom stays switched in
 			memset(pCxRomPeripheral+0x800, 0, FIRMWARE_EXPANSION_SIZE);
-			memset(mem+FIRMWARE_EXPANSION_BEGIN, 0, FIRMWARE_EXPANSION_SIZE);
+			UpdatePagingC8xx();
 			g_eExpansionRomType = eExpRomNull;
 		}
 
@@ -860,7 +840,7 @@ static BYTE __stdcall IO_Cxxx(WORD programcounter, WORD address, BYTE write, BYT
 			if (ExpansionRom[uSlot] && (g_uPeripheralRomSlot != uSlot))
 			{
 				memcpy(pCxRomPeripheral+0x800, ExpansionRom[uSlot], FIRMWARE_EXPANSION_SIZE);
-				memcpy(mem+FIRMWARE_EXPANSION_BEGIN, ExpansionRom[uSlot], FIRMWARE_EXPANSION_SIZE);
+				UpdatePagingC8xx();
 				g_eExpansionRomType = eExpRomPeripheral;
 				g_uPeripheralRomSlot = uSlot;
 			}
@@ -869,7 +849,7 @@ static BYTE __stdcall IO_Cxxx(WORD programcounter, WORD address, BYTE write, BYT
 		{
 			// Enable Internal ROM
 			// . Get this for PR#3
-			memcpy(mem+FIRMWARE_EXPANSION_BEGIN, pCxRomInternal+0x800, FIRMWARE_EXPANSION_SIZE);
+			UpdatePagingC8xx();
 			g_eExpansionRomType = eExpRomInternal;
 			g_uPeripheralRomSlot = 0;
 		}
@@ -901,7 +881,7 @@ static BYTE __stdcall IO_Cxxx(WORD programcounter, WORD address, BYTE write, BYT
 		if (INTC8ROM && (g_eExpansionRomType != eExpRomInternal))
 		{
 			// Enable Internal ROM
-			memcpy(mem+FIRMWARE_EXPANSION_BEGIN, pCxRomInternal+0x800, FIRMWARE_EXPANSION_SIZE);
+			UpdatePagingC8xx();
 			g_eExpansionRomType = eExpRomInternal;
 			g_uPeripheralRomSlot = 0;
 		}
@@ -925,7 +905,7 @@ static BYTE __stdcall IO_Cxxx(WORD programcounter, WORD address, BYTE write, BYT
 	if ((g_eExpansionRomType == eExpRomNull) && (address >= FIRMWARE_EXPANSION_BEGIN))
 		return IO_Null(programcounter, address, write, value, nExecutedCycles);
 
-	return mem[address];
+	return ReadByteFromMemory(address);
 }
 
 BYTE __stdcall IO_F8xx(WORD programcounter, WORD address, BYTE write, BYTE value, ULONG nCycles)	// NSC for Apple II/II+ (GH#827)
@@ -940,14 +920,11 @@ BYTE __stdcall IO_F8xx(WORD programcounter, WORD address, BYTE write, BYTE value
 
 	if (!write)
 	{
-		return *(mem+address);
+		return ReadByteFromMemory(address);
 	}
 	else
 	{
-		memdirty[address >> 8] = 0xFF;
-		LPBYTE page = memwrite[address >> 8];
-		if (page)
-			*(page+(address & 0xFF)) = value;
+		WriteByteToMemory(address, value);
 		return 0;
 	}
 }
@@ -1165,59 +1142,54 @@ void MemUpdatePaging(BOOL initialize)
 	UpdatePaging(initialize);
 }
 
-static void UpdatePaging(BOOL initialize)
+// $C800-$CFFF: peripheral or internal expansion ROM
+// . Also called directly when only INTC8ROM changes (no other paging changes)
+static void UpdatePagingC8xx(void)
 {
-	modechanging = 0;
-
-	// SAVE THE CURRENT PAGING SHADOW TABLE
-	LPBYTE oldshadow[256];
-	if (!initialize)
-		memcpy(oldshadow,memshadow,256*sizeof(LPBYTE));
+	for (UINT loop = 0xC8; loop < 0xD0; loop++)
+	{
+		const UINT uRomOffset = (loop & 0x0f) * 0x100;
+		memread[loop] = (!SW_INTCXROM && !INTC8ROM)	? pCxRomPeripheral+uRomOffset			// C800..CFFF - Peripheral ROM (GH#486)
+													: pCxRomInternal+uRomOffset;			// C800..CFFF - Internal ROM
+	}
+}
 
+static void UpdatePaging(BOOL initialize)
+{
 	// UPDATE THE PAGING TABLES BASED ON THE NEW PAGING SWITCH VALUES
+	// NB. memread/memwrite point straight at the backing-store, so there is nothing to copy (in either direction)
 	UINT loop;
-	if (initialize)
+	for (loop = 0x00; loop < 0x02; loop++)
 	{
-		for (loop = 0x00; loop < 0xC0; loop++)
-			memwrite[loop] = mem+(loop << 8);
-
-		for (loop = 0xC0; loop < 0xD0; loop++)
-			memwrite[loop] = NULL;
+		memread[loop]  = SW_ALTZP ? memaux+(loop << 8) : memmain+(loop << 8);
+		memwrite[loop] = memread[loop];
 	}
 
-	for (loop = 0x00; loop < 0x02; loop++)
-		memshadow[loop] = SW_ALTZP ? memaux+(loop << 8) : memmain+(loop << 8);
-
 	for (loop = 0x02; loop < 0xC0; loop++)
 	{
-		memshadow[loop] = SW_AUXREAD ? memaux+(loop << 8)
+		memread[loop]  = SW_AUXREAD ? memaux+(loop << 8)
 			: memmain+(loop << 8);
 
-		memwrite[loop]  = ((SW_AUXREAD != 0) == (SW_AUXWRITE != 0))
-			? mem+(loop << 8)
-			: SW_AUXWRITE	? memaux+(loop << 8)
-							: memmain+(loop << 8);
+		memwrite[loop] = SW_AUXWRITE	? memaux+(loop << 8)
+										: memmain+(loop << 8);
 	}
 
 	for (loop = 0xC0; loop < 0xC8; loop++)
 	{
-		memdirty[loop] = 0;	// mem(cache) can't be dirty for ROM (but STA $Csnn will set the dirty flag)
+		memwrite[loop] = NULL;
 		const UINT uSlotOffset = (loop & 0x0f) * 0x100;
 		if (loop == 0xC3)
-			memshadow[loop] = (SW_SLOTC3ROM && !SW_INTCXROM)	? pCxRomPeripheral+uSlotOffset	// C300..C3FF - Slot 3 ROM (all 0x00's)
-																: pCxRomInternal+uSlotOffset;	// C300..C3FF - Internal ROM
+			memread[loop] = (SW_SLOTC3ROM && !SW_INTCXROM)	? pCxRomPeripheral+uSlotOffset	// C300..C3FF - Slot 3 ROM (all 0x00's)
+															: pCxRomInternal+uSlotOffset;	// C300..C3FF - Internal ROM
 		else
-			memshadow[loop] = !SW_INTCXROM	? pCxRomPeripheral+uSlotOffset						// C000..C7FF - SSC/Disk][/etc
+			memread[loop] = !SW_INTCXROM	? pCxRomPeripheral+uSlotOffset						// C000..C7FF - SSC/Disk][/etc
 											: pCxRomInternal+uSlotOffset;						// C000..C7FF - Internal ROM
 	}
 
 	for (loop = 0xC8; loop < 0xD0; loop++)
-	{
-		memdirty[loop] = 0;	// mem(cache) can't be dirty for ROM (but STA $Cnnn will set the dirty flag)
-		const UINT uRomOffset = (loop & 0x0f) * 0x100;
-		memshadow[loop] = (!SW_INTCXROM && !INTC8ROM)	? pCxRomPeripheral+uRomOffset			// C800..CFFF - Peripheral ROM (GH#486)
-														: pCxRomInternal+uRomOffset;			// C800..CFFF - Internal ROM
-	}
+		memwrite[loop] = NULL;
+
+	UpdatePagingC8xx();
 
 	const int selectedrompage = (SW_ALTROM0 ? 1 : 0) | (SW_ALTROM1 ? 2 : 0);
 #ifdef _DEBUG
@@ -1227,25 +1199,25 @@ static void UpdatePaging(BOOL initialize)
 	for (loop = 0xD0; loop < 0xE0; loop++)
 	{
 		const int bankoffset = (SW_BANK2 ? 0 : 0x1000);
-		memshadow[loop] = SW_HIGHRAM ? SW_ALTZP	? memaux+(loop << 8)-bankoffset
-												: g_pMemMainLanguageCard+((loop-0xC0)<<8)-bankoffset
-									 : memrom+((loop-0xD0) * 0x100)+romoffset;
+		LPBYTE pRam = SW_ALTZP	? memaux+(loop << 8)-bankoffset
+								: g_pMemMainLanguageCard+((loop-0xC0)<<8)-bankoffset;
 
-		memwrite[loop]  = SW_WRITERAM	? SW_HIGHRAM	? mem+(loop << 8)
-														: SW_ALTZP	? memaux+(loop << 8)-bankoffset
-																	: g_pMemMainLanguageCard+((loop-0xC0)<<8)-bankoffset
+		memread[loop]  = SW_HIGHRAM		? pRam
+										: memrom+((loop-0xD0) * 0x100)+romoffset;
+
+		memwrite[loop] = SW_WRITERAM	? pRam
 										: NULL;
 	}
 
 	for (loop = 0xE0; loop < 0x100; loop++)
 	{
-		memshadow[loop] = SW_HIGHRAM	? SW_ALTZP	? memaux+(loop << 8)
-													: g_pMemMainLanguageCard+((loop-0xC0)<<8)
+		LPBYTE pRam = SW_ALTZP	? memaux+(loop << 8)
+								: g_pMemMainLanguageCard+((loop-0xC0)<<8);
+
+		memread[loop]  = SW_HIGHRAM		? pRam
 										: memrom+((loop-0xD0) * 0x100)+romoffset;
 
-		memwrite[loop]  = SW_WRITERAM	? SW_HIGHRAM	? mem+(loop << 8)
-														: SW_ALTZP	? memaux+(loop << 8)
-																	: g_pMemMainLanguageCard+((loop-0xC0)<<8)
+		memwrite[loop] = SW_WRITERAM	? pRam
 										: NULL;
 	}
 
@@ -1253,47 +1225,21 @@ static void UpdatePaging(BOOL initialize)
 	{
 		for (loop = 0x04; loop < 0x08; loop++)
 		{
-			memshadow[loop] = SW_PAGE2	? memaux+(loop << 8)
+			memread[loop]  = SW_PAGE2	? memaux+(loop << 8)
 										: memmain+(loop << 8);
-			memwrite[loop]  = mem+(loop << 8);
+			memwrite[loop] = memread[loop];
 		}
 
 		if (SW_HIRES)
 		{
 			for (loop = 0x20; loop < 0x40; loop++)
 			{
-				memshadow[loop] = SW_PAGE2	? memaux+(loop << 8)
+				memread[loop]  = SW_PAGE2	? memaux+(loop << 8)
 											: memmain+(loop << 8);
-				memwrite[loop]  = mem+(loop << 8);
+				memwrite[loop] = memread[loop];
 			}
 		}
 	}
-
-	// MOVE MEMORY BACK AND FORTH AS NECESSARY BETWEEN THE SHADOW AREAS AND
-	// THE MAIN RAM IMAGE TO KEEP BOTH SETS OF MEMORY CONSISTENT WITH THE NEW
-	// PAGING SHADOW TABLE
-	//
-	// NB. the condition 'loop <= 1' is there because:
-	// . Page0 (ZP) and Page1 (stack) are written to so often that it's almost certain that they'll be dirty every time this function is called.
-	// Note also that:
-	// . Page0 (ZP)    : memdirty[0] is set when the 6502 CPU writes to ZP.
-	// . Page1 (stack) : memdirty[1] is NOT set when the 6502 CPU writes to this page with JSR, PHA, etc.
-	// Ultimately this is an optimisation (due to Page1 writes not setting memdirty[1]) and Page0 could be optimised to also not set memdirty[0].
-
-	for (loop = 0x00; loop < 0x100; loop++)
-	{
-		if (initialize || (oldshadow[loop] != memshadow[loop]))
-		{
-			if (!initialize &&
-				((*(memdirty+loop) & 1) || (loop <= 1)))
-			{
-				*(memdirty+loop) &= ~1;
-				memcpy(oldshadow[loop],mem+(loop << 8),256);
-			}
-
-			memcpy(mem+(loop << 8),memshadow[loop],256);
-		}
-	}
 }
 
 //
@@ -1308,7 +1254,6 @@ void MemDestroy()
 	ALIGNED_FREE(memmain);
 	FreeMemImage();
 
-	delete [] memdirty;
 	delete [] memrom;
 
 	delete [] pCxRomInternal;
@@ -1328,7 +1273,6 @@ void MemDestroy()
 
 	memaux   = NULL;
 	memmain  = NULL;
-	memdirty = NULL;
 	memrom   = NULL;
 	memimage = NULL;
 
@@ -1337,8 +1281,8 @@ void MemDestroy()
 
 	mem      = NULL;
 
-	memset(memwrite,  0, sizeof(memwrite));
-	memset(memshadow, 0, sizeof(memshadow));
+	memset(memwrite, 0, sizeof(memwrite));
+	memset(memread,  0, sizeof(memread));
 }
 
 //===========================================================================
@@ -1355,29 +1299,11 @@ bool MemCheckINTCXROM()
 
 //===========================================================================
 
-static LPBYTE MemGetPtrBANK1(const WORD offset, const LPBYTE pMemBase)
-{
-	if ((offset & 0xF000) != 0xC000)	// Requesting RAM at physical addr $Cxxx (ie. 4K RAM BANK1)
-		return NULL;
-
-	// NB. This works for memaux when set to any RWpages[] value, ie. RamWork III "just works"
-	const BYTE bank1page = (offset >> 8) & 0xF;
-	return (memshadow[0xD0+bank1page] == pMemBase+(0xC0+bank1page)*256)
-		? mem+offset+0x1000				// Return ptr to $Dxxx address - 'mem' has (a potentially dirty) 4K RAM BANK1 mapped in at $D000
-		: pMemBase+offset;				// Else return ptr to $Cxxx address
-}
-
-//-------------------------------------
+// NB. The backing-store is always up-to-date (memwrite points directly into it), so no need to check memread
 
 LPBYTE MemGetAuxPtr(const WORD offset)
 {
-	LPBYTE lpMem = MemGetPtrBANK1(offset, memaux);
-	if (lpMem)
-		return lpMem;
-
-	lpMem = (memshadow[(offset >> 8)] == (memaux+(offset & 0xFF00)))
-			? mem+offset				// Return 'mem' copy if possible, as page could be dirty
-			: memaux+offset;
+	LPBYTE lpMem = memaux+offset;
 
 #ifdef RAMWORKS
 	// Video scanner (for 14M video modes) always fetches from 1st 64K aux bank (UTAIIe ref?)
@@ -1388,9 +1314,7 @@ LPBYTE MemGetAuxPtr(const WORD offset)
 			)
 		)
 	{
-		lpMem = (memshadow[(offset >> 8)] == (RWpages[0]+(offset & 0xFF00)))
-			? mem+offset
-			: RWpages[0]+offset;
+		lpMem = RWpages[0]+offset;
 	}
 #endif
 
@@ -1399,56 +1323,36 @@ LPBYTE MemGetAuxPtr(const WORD offset)
 
 //-------------------------------------
 
-// if memshadow == memmain
-//	  so RD memmain
-//	  case: RD == WR
-//		so RD(mem),WR(mem)
-//		so 64K memmain could be incorrect
-//		*therefore mem is correct
-//	  case: RD != WR
-//		so RD(mem),WR(memaux)
-//		doesn't matter since RD != WR, then it's guaranteed that memaux is correct
-//		*therefore either mem or memmain is correct
-// else ; memshadow != memmain
-//	  so RD memaux (or ROM)
-//	  case: RD == WR
-//		so RD(mem),WR(mem)
-//		so 64K memaux could be incorrect
-//		*therefore memmain is correct
-//	  case: RD != WR
-//		so RD(mem),WR(memmain)
-//		doesn't matter since RD != WR, then it's guaranteed that memmain is correct
-//		*therefore memmain is correct
-//
-// *OR*
-//
-// Is the mem(cache) setup to read (via memshadow) from memmain?
-// . if yes, then return the mem(cache) address as writes (via memwrite) may've made the mem(cache) dirty.
-// . if no, then return memmain, as the mem(cache) isn't involved in memmain (any writes will go directly to this backing-store).
-//
-
 LPBYTE MemGetMainPtr(const WORD offset)
 {
-	LPBYTE lpMem = MemGetPtrBANK1(offset, memmain);
-	if (lpMem)
-		return lpMem;
+	return memmain+offset;
+}
+
+//-------------------------------------
 
-	return (memshadow[(offset >> 8)] == (memmain+(offset & 0xFF00)))
-			? mem+offset				// Return 'mem' copy if possible, as page could be dirty
-			: memmain+offset;
+// Copy every page the video scanner can fetch from ($0000-$9FFF: TEXT/LORES, HGR, SHR & the debugger's pseudo pages)
+// . for the full-speed render thread (see NTSC_VideoRenderFrame())
+// . pMain, pAux: 64K each, the rest is left untouched
+// . aux is copied through MemGetAuxPtr(), so the RamWorks bank the scanner reads is resolved now
+void MemCopyVideoPages(LPBYTE pMain, LPBYTE pAux)
+{
+	const UINT kVideoPages = 0xA0;
+	memcpy(pMain, MemGetMainPtr(0), kVideoPages << 8);
+
+	for (UINT page = 0; page < kVideoPages; page++)
+		memcpy(pAux + (page << 8), MemGetAuxPtr(page << 8), 256);
 }
 
 //===========================================================================
 
-static void BackMainImage(void)
+// Refresh the 'mem' view from the current read pages, for code that needs a flat 64K array
+// . a copy, so writes to it don't reach the 6502's memory
+LPBYTE MemUpdateView(void)
 {
 	for (UINT loop = 0; loop < 256; loop++)
-	{
-		if (memshadow[loop] && ((*(memdirty + loop) & 1) || (loop <= 1)))
-			memcpy(memshadow[loop], mem + (loop << 8), 256);
+		memcpy(mem + (loop << 8), memread[loop], 256);
 
-		*(memdirty + loop) &= ~1;
-	}
+	return mem;
 }
 
 //-------------------------------------
@@ -1457,13 +1361,8 @@ static void BackMainImage(void)
 // . Savestate: MemSaveSnapshotMemory(), MemLoadSnapshotAux()
 // . VidHD    : SaveSnapshot(), LoadSnapshot()
 // . Debugger : CmdMemorySave(), CmdMemoryLoad()
-LPBYTE MemGetBankPtr(const UINT nBank, const bool isSaveSnapshotOrDebugging/*=true*/)
+LPBYTE MemGetBankPtr(const UINT nBank)
 {
-	// Only call BackMainImage() when a consistent 64K bank is needed, eg. for saving snapshot or debugging
-	// - for snapshot *loads* it's redundant, and worse it can corrupt pages 0 & 1 for aux banks, so must be avoided (GH#1262)
-	if (isSaveSnapshotOrDebugging)
-		BackMainImage();	// Flush any dirty pages to back-buffer
-
 #ifdef RAMWORKS
 	if (nBank > g_uMaxExPages)
 		return NULL;
@@ -1674,13 +1573,12 @@ void MemInitialize()
 	memmain  = ALIGNED_ALLOC(_6502_MEM_LEN);
 	memimage = AllocMemImage();
 
-	memdirty = new BYTE[0x100];
 	memrom   = new BYTE[0x3000 * MaxRomPages];
 
 	pCxRomInternal		= new BYTE[CxRomSize];
 	pCxRomPeripheral	= new BYTE[CxRomSize];
 
-	if (!memaux || !memdirty || !memimage || !memmain || !memrom || !pCxRomInternal || !pCxRomPeripheral)
+	if (!memaux || !memimage || !memmain || !memrom || !pCxRomInternal || !pCxRomPeripheral)
 	{
 		GetFrame().FrameMessageBox(
 			TEXT("The emulator was unable to allocate the memory it ")
@@ -1931,7 +1829,6 @@ void MemInitializeFromSnapshot(void)
 		_ASSERT(g_eExpansionRomType == eExpRomPeripheral);
 
 		memcpy(pCxRomPeripheral + 0x800, ExpansionRom[uSlot], FIRMWARE_EXPANSION_SIZE);
-		// NB. Copied to /mem/ by UpdatePaging(TRUE)
 	}
 
 	GetCardMgr().GetLanguageCardMgr().SetMemModeFromSnapshot();
@@ -1966,8 +1863,8 @@ inline DWORD getRandomTime()
 void MemReset()
 {
 	// INITIALIZE THE PAGING TABLES
-	memset(memshadow, 0, 256*sizeof(LPBYTE));
-	memset(memwrite , 0, 256*sizeof(LPBYTE));
+	memset(memread , 0, 256*sizeof(LPBYTE));
+	memset(memwrite, 0, 256*sizeof(LPBYTE));
 
 	// INITIALIZE THE RAM IMAGES
 	memset(memaux , 0, 0x10000);
@@ -1979,8 +1876,6 @@ void MemReset()
 	g_eExpansionRomType = eExpRomNull;
 	g_uPeripheralRomSlot = 0;
 
-	memset(memdirty, 0, 0x100);
-
 	memVidHD = NULL;
 
 	//
@@ -2105,15 +2000,15 @@ void MemReset()
 	memmain[ 0xBFFE ] = 0;
 	memmain[ 0xBFFF ] = 0;
 
-	// SET UP THE MEMORY IMAGE
+	// SET UP THE MEMORY VIEW
 	mem = memimage;
 
-	// INITIALIZE PAGING, FILLING IN THE 64K MEMORY IMAGE
+	// INITIALIZE PAGING
 	ResetPaging(TRUE);		// Initialize=1, init g_memmode
 	MemAnnunciatorReset();
 
 	// INITIALIZE & RESET THE CPU
-	// . Do this after ROM has been copied back to mem[], so that PC is correctly init'ed from 6502's reset vector
+	// . Do this after the paging tables are setup, so that PC is correctly init'ed from 6502's reset vector
 	CpuInitialize();
 	//Sets Caps Lock = false (Pravets 8A/C only)
 
@@ -2127,7 +2022,7 @@ void MemReset()
 
 BYTE MemReadFloatingBus(const ULONG uExecutedCycles)
 {
-	return mem[ NTSC_VideoGetScannerAddress(uExecutedCycles) ];		// OK: This does the 2-cycle adjust for ANSI STORY (End Credits)
+	return ReadByteFromMemory( NTSC_VideoGetScannerAddress(uExecutedCycles) );		// OK: This does the 2-cycle adjust for ANSI STORY (End Credits)
 }
 
 //===========================================================================
@@ -2233,12 +2128,9 @@ BYTE __stdcall MemSetPaging(WORD programcounter, WORD address, BYTE write, BYTE
 		}
 	}
 
-	if (MemOptimizeForModeChanging(programcounter, address))
-		return write ? 0 : MemReadFloatingBus(nExecutedCycles);
-
 	// IF THE MEMORY PAGING MODE HAS CHANGED, UPDATE OUR MEMORY IMAGES AND
 	// WRITE TABLES.
-	if ((lastmemmode != g_memmode) || modechanging)
+	if (lastmemmode != g_memmode)
 	{
 		// NB. Must check MF_SLOTC3ROM too, as IoHandlerCardsIn() depends on both MF_INTCXROM|MF_SLOTC3ROM
 		if ((lastmemmode & (MF_INTCXROM|MF_SLOTC3ROM)) != (g_memmode & (MF_INTCXROM|MF_SLOTC3ROM)))
@@ -2251,7 +2143,6 @@ BYTE __stdcall MemSetPaging(WORD programcounter, WORD address, BYTE write, BYTE
 					// . Similar to $CFFF access
 					// . None of the peripheral cards can be driving the bus - so use the null ROM
 					memset(pCxRomPeripheral+0x800, 0, FIRMWARE_EXPANSION_SIZE);
-					memset(mem+FIRMWARE_EXPANSION_BEGIN, 0, FIRMWARE_EXPANSION_SIZE);
 					g_eExpansionRomType = eExpRomNull;
 					g_uPeripheralRomSlot = 0;
 				}
@@ -2260,7 +2151,6 @@ BYTE __stdcall MemSetPaging(WORD programcounter, WORD address, BYTE write, BYTE
 			else
 			{
 				// Enable Internal ROM
-				memcpy(mem+0xC800, pCxRomInternal+0x800, FIRMWARE_EXPANSION_SIZE);
 				g_eExpansionRomType = eExpRomInternal;
 				g_uPeripheralRomSlot = 0;
 				IoHandlerCardsOut();
@@ -2279,40 +2169,6 @@ BYTE __stdcall MemSetPaging(WORD programcounter, WORD address, BYTE write, BYTE
 
 //===========================================================================
 
-bool MemOptimizeForModeChanging(WORD programcounter, WORD address)
-{
-	if (IsAppleIIeOrAbove(GetApple2Type()))
-	{
-		if (programcounter > 0xFFFC)	// Prevent out of bounds access!
-			return false;
-
-		// IF THE EMULATED PROGRAM HAS JUST UPDATED THE MEMORY WRITE MODE AND IS
-		// ABOUT TO UPDATE THE MEMORY READ MODE, HOLD OFF ON ANY PROCESSING UNTIL
-		// IT DOES SO.
-		//
-		// NB. A 6502 interrupt occurring between these memory write & read updates could lead to incorrect behaviour.
-		// - although any data-race is probably a bug in the 6502 code too.
-		if ((address >= 4) && (address <= 5) &&									// Now:  RAMWRTOFF or RAMWRTON
-			((*(LPDWORD)(mem+programcounter) & 0x00FFFEFF) == 0x00C0028D))		// Next: STA $C002(RAMRDOFF) or STA $C003(RAMRDON)
-		{
-				modechanging = 1;
-				return true;
-		}
-
-		// TODO: support Saturn in any slot.
-		// NB. GH#602 asks for any examples of this happening:
-		if ((address >= 0x80) && (address <= 0x8F) && (programcounter < 0xC000) &&	// Now: LC
-			(((*(LPDWORD)(mem+programcounter) & 0x00FFFEFF) == 0x00C0048D) ||		// Next: STA $C004(RAMWRTOFF) or STA $C005(RAMWRTON)
-			 ((*(LPDWORD)(mem+programcounter) & 0x00FFFEFF) == 0x00C0028D)))		//    or STA $C002(RAMRDOFF)  or STA $C003(RAMRDON)
-		{
-				modechanging = 1;
-				return true;
-		}
-	}
-
-	return false;
-}
-
 //===========================================================================
 
 LPVOID MemGetSlotParameters(UINT uSlot)
@@ -2362,10 +2218,6 @@ void MemRemoveNoSlotClock(void)
 
 //===========================================================================
 
-// NB. Don't need to save 'modechanging', as this is just an optimisation to save calling UpdatePaging() twice.
-// . If we were to save the state when 'modechanging' is set, then on restoring the state, the 6502 code will immediately update the read memory mode.
-// . This will work correctly.
-
 #define SS_YAML_KEY_MEMORYMODE "Memory Mode"
 #define SS_YAML_KEY_LASTRAMWRITE "Last RAM Write"
 #define SS_YAML_KEY_IOSELECT "IO_SELECT"
@@ -2554,8 +2406,6 @@ bool MemLoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT unitVersion)
 		memcpy(g_pMemMainLanguageCard, memmain+0xC000, LanguageCardSlot0::kMemBankSize);
 		memset(memmain+0xC000, 0, LanguageCardSlot0::kMemBankSize);
 	}
-	memset(memdirty, 0, 0x100);
-
 	yamlLoadHelper.PopMap();
 
 	// NB. MemInitializeFromSnapshot()->MemUpdatePaging() called at end of Snapshot_LoadState_v2()
@@ -2646,7 +2496,7 @@ static void MemLoadSnapshotAuxCommon(YamlLoadHelper& yamlLoadHelper, const std::
 
 	for(UINT uBank = 1; uBank <= g_uMaxExPages; uBank++)
 	{
-		LPBYTE pBank = MemGetBankPtr(uBank, false);
+		LPBYTE pBank = MemGetBankPtr(uBank);
 		if (!pBank)
 		{
 			pBank = RWpages[uBank-1] = ALIGNED_ALLOC(_6502_MEM_LEN);
@@ -40,11 +40,38 @@ typedef BYTE (__stdcall *iofunction)(WORD nPC, WORD nAddr, BYTE nWriteFlag, BYTE
 
 extern iofunction IORead[256];
 extern iofunction IOWrite[256];
+extern LPBYTE     memread[0x100];
 extern LPBYTE     memwrite[0x100];
 extern LPBYTE     mem;
-extern LPBYTE     memdirty;
 extern LPBYTE     memVidHD;
 
+// The 64K address space as currently mapped for the 6502 (no I/O: $C0xx reads the ROM underneath)
+inline LPBYTE MemGetReadPtr(const WORD addr)
+{
+	return memread[addr >> 8] + (addr & 0xFF);
+}
+
+inline BYTE ReadByteFromMemory(const WORD addr)
+{
+	return *MemGetReadPtr(addr);
+}
+
+inline WORD ReadWordFromMemory(const WORD addr)
+{
+	if ((addr & 0xFF) != 0xFF)
+		return *(LPWORD)MemGetReadPtr(addr);	// both bytes in the same page
+
+	return ReadByteFromMemory(addr) | (ReadByteFromMemory(addr + 1) << 8);
+}
+
+// Write as the 6502 would, but without I/O (writes to ROM or $Cxxx are ignored)
+inline void WriteByteToMemory(const WORD addr, const BYTE value)
+{
+	LPBYTE page = memwrite[addr >> 8];
+	if (page)
+		*(page + (addr & 0xFF)) = value;
+}
+
 #ifdef RAMWORKS
 const UINT kMaxExMemoryBanks = 127;	// 127 * aux mem(64K) + main mem(64K) = 8MB
 #endif
@@ -57,11 +84,12 @@ bool	MemCheckSLOTC3ROM();
 bool	MemCheckINTCXROM();
 LPBYTE  MemGetAuxPtr(const WORD);
 LPBYTE  MemGetMainPtr(const WORD);
-LPBYTE  MemGetBankPtr(const UINT nBank, const bool isSaveSnapshotOrDebugging = true);
+void    MemCopyVideoPages(LPBYTE pMain, LPBYTE pAux);
+LPBYTE  MemGetBankPtr(const UINT nBank);
+LPBYTE  MemUpdateView(void);
 LPBYTE  MemGetCxRomPeripheral();
 DWORD   GetMemMode(void);
 void    SetMemMode(DWORD memmode);
-bool	MemOptimizeForModeChanging(WORD programcounter, WORD address);
 bool    MemIsAddrCodeMemory(const USHORT addr);
 void    MemInitialize ();
 void    MemInitializeROM(void);
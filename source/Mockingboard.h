@@ -17,6 +17,7 @@ public:
 	virtual void Destroy();
 	virtual void Reset(const bool powerCycle);
 	virtual void Update(const ULONG executedCycles);
+	virtual ULONG GetCyclesUntilUpdate(void);
 	virtual void SaveSnapshot(YamlSaveHelper& yamlSaveHelper);
 	virtual bool LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT version);
 
@@ -212,6 +212,8 @@ void MockingboardCardManager::Destroy(void)
 	DSReleaseSoundBuffer(&m_mockingboardVoice);
 }
 
+static const UINT kCyclesPerAudioFrame = 1000;
+
 // Called by ContinueExecution() at the end of every execution period (~1000 cycles or ~3 cycles when MODE_STEPPING)
 // NB. Required for FT's TEST LAB #1 player
 void MockingboardCardManager::Update(const ULONG executedCycles)
@@ -234,7 +236,6 @@ void MockingboardCardManager::Update(const ULONG executedCycles)
 
 	// No 6522 TIMER1's are active, so periodically update AY8913's here...
 
-	const UINT kCyclesPerAudioFrame = 1000;
 	m_cyclesThisAudioFrame += executedCycles;
 	if (m_cyclesThisAudioFrame < kCyclesPerAudioFrame)
 		return;
@@ -244,6 +245,40 @@ void MockingboardCardManager::Update(const ULONG executedCycles)
 	UpdateSoundBuffer();
 }
 
+// Update() is only due when it would generate sound, ie. no 6522 TIMER1's are active & there is a sound buffer
+ULONG MockingboardCardManager::GetCyclesUntilUpdate(void)
+{
+	bool present = false;
+	for (UINT i = SLOT0; i < NUM_SLOTS; i++)
+	{
+		if (IsMockingboard(i))
+		{
+			if (dynamic_cast<MockingboardCard&>(GetCardMgr().GetRef(i)).IsAnyTimer1Active())
+				return CYCLES_UNTIL_UPDATE_NONE;
+			present = true;
+		}
+	}
+
+	if (!present)
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	if (!m_mockingboardVoice.lpDSBvoice && (g_bDisableDirectSound || g_bDisableDirectSoundMockingboard))
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	return kCyclesPerAudioFrame - m_cyclesThisAudioFrame;
+}
+
+bool MockingboardCardManager::IsAnyTimer1Active(void)
+{
+	for (UINT i = SLOT0; i < NUM_SLOTS; i++)
+	{
+		if (IsMockingboard(i) && dynamic_cast<MockingboardCard&>(GetCardMgr().GetRef(i)).IsAnyTimer1Active())
+			return true;
+	}
+
+	return false;
+}
+
 // Called by:
 // . MB_SyncEventCallback() on a TIMER1 (not TIMER2) underflow - when IsAnyTimer1Active() == true
 // . Update()                                                  - when IsAnyTimer1Active() == false
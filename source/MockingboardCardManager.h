@@ -42,6 +42,7 @@ public:
 		m_cyclesThisAudioFrame = 0;
 	}
 	void Update(const ULONG executedCycles);
+	ULONG GetCyclesUntilUpdate(void);
 	void UpdateSoundBuffer(void);
 
 #ifdef _DEBUG
@@ -54,6 +55,7 @@ private:
 	UINT GenerateAllSoundData(void);
 	void MixAllAndCopyToRingBuffer(UINT nNumSamples);
 	bool IsMockingboardExtraCardType(UINT slot);
+	bool IsAnyTimer1Active(void);
 
 	static const DWORD SOUNDBUFFER_SIZE = MAX_SAMPLES * sizeof(short) * MockingboardCard::NUM_MB_CHANNELS;
 
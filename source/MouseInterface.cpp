@@ -236,9 +236,7 @@ void CMouseInterface::SetSlotRom()
 		return;
 
 	UINT uOffset = (m_by6821B << 7) & 0x0700;
-	memcpy(pCxRomPeripheral+m_slot*256, m_pSlotRom+uOffset, 256);
-	if (mem)
-		memcpy(mem+0xC000+m_slot*256, m_pSlotRom+uOffset, 256);
+	memcpy(pCxRomPeripheral+m_slot*256, m_pSlotRom+uOffset, 256);	// memread[] points here, so no need to update the paging
 }
 
 //===========================================================================
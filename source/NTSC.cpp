@@ -31,6 +31,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 	#include "NTSC_CharSet.h"
 
+	#include <mutex>
+
 // Some reference material here from 2000:
 // http://www.kreativekorp.com/miscpages/a2info/munafo.shtml
 //
@@ -55,6 +57,15 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 	#define INLINE inline
 #endif
 
+// SIMD kernels for the TV in-between scanline blend (selected at runtime, see NTSC_VideoInit())
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+	#define NTSC_SIMD_SSE2 1
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+	#define NTSC_SIMD_NEON 1
+	#include <arm_neon.h>
+#endif
+
 	#define PI 3.1415926535898f
 	#define DEG_TO_RAD(x) (PI*(x)/180.f) // 2PI=360, PI=180,PI/2=90,PI/4=45
 	#define RAD_45  PI*0.25f
@@ -81,6 +92,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 	static bool g_bDelayVideoMode = false;	// NB. No need to save to save-state, as it will be done immediately after opcode completes in NTSC_VideoUpdateCycles()
 	static uint32_t g_uNewVideoModeFlags = 0;
 
+	static bool g_bVideoRenderSkip = false;	// see NTSC_SetVideoRenderSkip()
+
 	// Understanding the Apple II, Timing Generation and the Video Scanner, Pg 3-11
 	// Vertical Scanning
 	// Horizontal Scanning
@@ -121,6 +134,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 	static UpdatePixelFunc_t g_pFuncUpdateBnWPixel = 0; //updatePixelBnWMonitorSingleScanline;
 	static UpdatePixelFunc_t g_pFuncUpdateHuePixel = 0; //updatePixelHueMonitorSingleScanline;
 
+	typedef void (*BlendScanlineFunc_t)(uint32_t* pLine1, const uint32_t* pLine0, const uint32_t* pLine2, int count);
+	static BlendScanlineFunc_t g_pFuncBlendScanlineTVSingle = 0; // blendScanlineTV<true>
+	static BlendScanlineFunc_t g_pFuncBlendScanlineTVDouble = 0; // blendScanlineTV<false>
+
 	static uint8_t  g_nTextFlashCounter = 0;
 	static uint16_t g_nTextFlashMask    = 0;
 
@@ -134,6 +151,73 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 	static int g_nColorPhaseNTSC = INITIAL_COLOR_PHASE;
 	static int g_nSignalBitsNTSC = 0;
 
+	// HGR scanline fetched cycle-by-cycle, but rendered in one pass at the end of the line (see updateScreenSingleHires40())
+	static uint8_t g_aHiresLineBytes[VIDEO_SCANNER_MAX_HORZ - VIDEO_SCANNER_HORZ_START];
+	static int g_nHiresLineBytes = 0;
+	static bool g_bHiresLineBatched = false;
+
+	// Last render of each whole scanline, so that unchanged scanlines can be skipped (see startCachedLine())
+	#define LINE_CACHE_BYTES (VIDEO_SCANNER_MAX_HORZ - VIDEO_SCANNER_HORZ_START)
+	struct LineCache_t
+	{
+		uint32_t serial;	// only valid if == g_nLineCacheSerial
+		UpdateScreenFunc_t updateScreen;
+		uint32_t videoModeFlags;
+		bgra_t* pVideoAddress;
+		UpdatePixelFunc_t updatePixel;
+		csbits_t charSet;	// text modes only
+		int videoCharSet;
+		uint16_t textFlashMask;
+		int signalBits, colorPhase, lastColumnPixel;			// at the start of the scanline
+		bgra_t* pVideoAddressEnd;
+		int signalBitsEnd, colorPhaseEnd, lastColumnPixelEnd;	// before its last byte
+		uint8_t bytesMain[LINE_CACHE_BYTES];
+		uint8_t bytesAux[LINE_CACHE_BYTES];
+	};
+	static LineCache_t g_aLineCache[VIDEO_SCANNER_Y_DISPLAY];
+	static uint32_t g_nLineCacheSerial = 1;
+	static bool g_bLineCached = false;			// this scanline's cache entry is up to date
+	static bool g_bLineUnchanged = false;		// this scanline's bytes & state are the same as its last render
+	static bool g_bLinePrevUnchanged = false;	// ...and for the previous scanline (its pixels are blended into this scanline's in-between line)
+	static bool g_bLineSkipped = false;			// this scanline's last render is being left in the framebuffer
+	static uint16_t g_nLineAddress = 0;			// of this scanline's bytes
+
+	static DirtyScanlines_t g_aDirtyScanlines;
+
+	// Full-speed render thread: see NTSC_VideoRenderFrame()
+	static std::recursive_mutex g_mutexRenderFrame;
+	static bool g_bRenderFrameStarted = false;		// only changed by the emulation thread, while no frame is being rendered
+	static uint8_t* g_pRenderFramebuffer = NULL;	// only set on the render thread
+
+	// The memory the video scanner fetches from: NULL for the 6502's, else the render thread's copy of the video pages
+	static LPBYTE g_pVideoMemMain = NULL;
+	static LPBYTE g_pVideoMemAux = NULL;
+
+	// The video scanner & mode state that rendering changes
+	// . the render thread keeps its own copy, and only swaps it in (with the lock held) for each slice of its frame,
+	//   so the emulation thread's scanner position & mode (ie. what the 6502 can see) are never changed by it
+	struct ScannerState_t
+	{
+		uint16_t videoClockVert, videoClockHorz;
+		int videoCharSet, videoMixed, hiresPage, textPage;
+		bool delayVideoMode;
+		uint32_t newVideoModeFlags;
+		bgra_t* pVideoAddress;
+		bgra_t* pScanLines[VIDEO_SCANNER_Y_DISPLAY_IIGS * 2];
+		UpdateScreenFunc_t funcUpdateTextScreen, funcUpdateGraphicsScreen;
+		uint8_t textFlashCounter;
+		uint16_t textFlashMask;
+		int lastColumnPixelNTSC, colorBurstPixels, colorPhaseNTSC, signalBitsNTSC;
+		uint8_t hiresLineBytes[VIDEO_SCANNER_MAX_HORZ - VIDEO_SCANNER_HORZ_START];
+		int nHiresLineBytes;
+		bool hiresLineBatched, lineCached, lineUnchanged, linePrevUnchanged, lineSkipped;
+		uint16_t lineAddress;
+		DirtyScanlines_t dirtyScanlines;
+		int rgbTextFB;
+		LPBYTE pVideoMemMain, pVideoMemAux;
+	};
+	static ScannerState_t g_renderThreadState = {};
+
 	#define NTSC_NUM_PHASES     4
 	#define NTSC_NUM_SEQUENCES  4096
 
@@ -350,6 +434,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 	static void updateScreenDoubleHires80Simplified(long cycles6502);
 	static void updateScreenDoubleHires80RGB(long cycles6502);
 	static void updateScreenSHR(long cycles6502);
+	static void flushHiresLine(void);
+	static void flushLine(void);
 
 //===========================================================================
 static void set_csbits()
@@ -577,6 +663,98 @@ inline void updateFramebufferMonitorDoubleScanline( uint16_t signal, bgra_t *pTa
 }
 #endif
 
+//===========================================================================
+
+// Whole-row versions of the in-between scanline blend in updateFramebufferTV{Single,Double}Scanline()
+// . bHalfScanlines: 50% brightness for the in-between line (TV Single)
+// NB. The SIMD versions do the same per-byte maths, so are pixel-identical to the scalar version
+
+template <bool bHalfScanlines>
+static void blendScanlineTV(uint32_t* pLine1, const uint32_t* pLine0, const uint32_t* pLine2, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		uint32_t color1 = ((pLine0[i] & 0x00fefefe) >> 1) + ((pLine2[i] & 0x00fefefe) >> 1); // 50% Blend
+		if (bHalfScanlines)
+			color1 = (color1 & 0x00fefefe) >> 1;
+		pLine1[i] = color1 | ALPHA32_MASK;
+	}
+}
+
+#if NTSC_SIMD_SSE2
+template <bool bHalfScanlines>
+static void blendScanlineTV_SSE2(uint32_t* pLine1, const uint32_t* pLine0, const uint32_t* pLine2, int count)
+{
+	const __m128i mask  = _mm_set1_epi32(0x00fefefe);
+	const __m128i alpha = _mm_set1_epi32(ALPHA32_MASK);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i color0 = _mm_loadu_si128((const __m128i*)(pLine0 + i));
+		const __m128i color2 = _mm_loadu_si128((const __m128i*)(pLine2 + i));
+		__m128i color1 = _mm_add_epi32(_mm_srli_epi32(_mm_and_si128(color0, mask), 1), _mm_srli_epi32(_mm_and_si128(color2, mask), 1));
+		if (bHalfScanlines)
+			color1 = _mm_srli_epi32(_mm_and_si128(color1, mask), 1);
+		_mm_storeu_si128((__m128i*)(pLine1 + i), _mm_or_si128(color1, alpha));
+	}
+
+	blendScanlineTV<bHalfScanlines>(pLine1 + i, pLine0 + i, pLine2 + i, count - i);
+}
+#endif
+
+#if NTSC_SIMD_NEON
+template <bool bHalfScanlines>
+static void blendScanlineTV_NEON(uint32_t* pLine1, const uint32_t* pLine0, const uint32_t* pLine2, int count)
+{
+	const uint32x4_t mask  = vdupq_n_u32(0x00fefefe);
+	const uint32x4_t alpha = vdupq_n_u32(ALPHA32_MASK);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const uint32x4_t color0 = vld1q_u32(pLine0 + i);
+		const uint32x4_t color2 = vld1q_u32(pLine2 + i);
+		uint32x4_t color1 = vaddq_u32(vshrq_n_u32(vandq_u32(color0, mask), 1), vshrq_n_u32(vandq_u32(color2, mask), 1));
+		if (bHalfScanlines)
+			color1 = vshrq_n_u32(vandq_u32(color1, mask), 1);
+		vst1q_u32(pLine1 + i, vorrq_u32(color1, alpha));
+	}
+
+	blendScanlineTV<bHalfScanlines>(pLine1 + i, pLine0 + i, pLine2 + i, count - i);
+}
+#endif
+
+static bool IsSimdBlendSupported(void)
+{
+#if NTSC_SIMD_SSE2 && defined(_MSC_VER)
+	return IsProcessorFeaturePresent(PF_XMMI64_INSTRUCTIONS_AVAILABLE) != FALSE;
+#elif NTSC_SIMD_SSE2
+	return __builtin_cpu_supports("sse2");
+#elif NTSC_SIMD_NEON
+	return true;	// Mandatory on AArch64, and only compiled in for ARMv7 when the build enables it
+#else
+	return false;
+#endif
+}
+
+static void initBlendScanlineFuncs(void)
+{
+	g_pFuncBlendScanlineTVSingle = blendScanlineTV<true>;
+	g_pFuncBlendScanlineTVDouble = blendScanlineTV<false>;
+
+	if (!IsSimdBlendSupported())
+		return;
+
+#if NTSC_SIMD_SSE2
+	g_pFuncBlendScanlineTVSingle = blendScanlineTV_SSE2<true>;
+	g_pFuncBlendScanlineTVDouble = blendScanlineTV_SSE2<false>;
+#elif NTSC_SIMD_NEON
+	g_pFuncBlendScanlineTVSingle = blendScanlineTV_NEON<true>;
+	g_pFuncBlendScanlineTVDouble = blendScanlineTV_NEON<false>;
+#endif
+}
+
 //===========================================================================
 inline bool GetColorBurst( void )
 {
@@ -656,6 +834,22 @@ inline void updatePixels(uint16_t bits)
 
 //===========================================================================
 
+// At the end of every scanline (called before g_nVideoClockVert is incremented)
+inline void updateDirtyScanlines()
+{
+	if (g_nVideoClockVert < VIDEO_SCANNER_Y_DISPLAY_IIGS && !g_bLineSkipped)
+		g_aDirtyScanlines.set(g_nVideoClockVert);
+
+	// Rendered some other way, so the cached render is no longer in the framebuffer
+	if (g_nVideoClockVert < VIDEO_SCANNER_Y_DISPLAY && !g_bLineCached)
+		g_aLineCache[g_nVideoClockVert].serial = 0;
+
+	g_bLinePrevUnchanged = g_bLineUnchanged;
+	g_bLineCached = g_bLineUnchanged = g_bLineSkipped = false;
+}
+
+//===========================================================================
+
 inline void updateVideoScannerHorzEOLSimple()
 {
 	if (VIDEO_SCANNER_MAX_HORZ == ++g_nVideoClockHorz)
@@ -666,6 +860,7 @@ inline void updateVideoScannerHorzEOLSimple()
 			*(getScanlineNextInbetween()) = 0 | ALPHA32_MASK;	// ...and clear junk on RHS for non-'50% Scan lines'
 		}
 
+		updateDirtyScanlines();
 		g_nVideoClockHorz = 0;
 
 		if (++g_nVideoClockVert == g_videoScannerMaxVert)
@@ -710,6 +905,7 @@ inline void updateVideoScannerHorzEOL()
 			}
 		}
 
+		updateDirtyScanlines();
 		g_nVideoClockHorz = 0;
 
 		if (++g_nVideoClockVert == g_videoScannerMaxVert)
@@ -730,6 +926,7 @@ inline void updateVideoScannerHorzEOL_SHR()
 {
 	if (VIDEO_SCANNER_MAX_HORZ == ++g_nVideoClockHorz)
 	{
+		updateDirtyScanlines();
 		g_nVideoClockHorz = 0;
 
 		if (++g_nVideoClockVert == g_videoScannerMaxVert)
@@ -896,6 +1093,18 @@ INLINE uint16_t getVideoScannerAddressSHR()
 	return 0x2000 + kBytesPerScanline * g_nVideoClockVert + kBytesPerCycle * (g_nVideoClockHorz - VIDEO_SCANNER_HORZ_START);
 }
 
+//===========================================================================
+INLINE uint8_t* getVideoMainPtr(const uint16_t addr)
+{
+	return g_pVideoMemMain ? g_pVideoMemMain + addr : MemGetMainPtr(addr);
+}
+
+//===========================================================================
+INLINE uint8_t* getVideoAuxPtr(const uint16_t addr)
+{
+	return g_pVideoMemAux ? g_pVideoMemAux + addr : MemGetAuxPtr(addr);
+}
+
 // Non-Inline _________________________________________________________
 
 // Build the 4 phase chroma lookup table
@@ -1241,6 +1450,113 @@ static void updatePixelHueMonitorDoubleScanline (uint16_t compositeSignal)
 	updateColorPhase();
 }
 
+//===========================================================================
+
+// Batched TV rendering: only draw the current scanline, as the in-between scanline is blended for the whole row after (see blendRowTV())
+static void updatePixelHueColorTVRow (uint16_t compositeSignal)
+{
+	*getScanlineCurrent() = getScanlineColor(compositeSignal, g_aHueColorTV[g_nColorPhaseNTSC]);
+	g_pVideoAddress++;
+	updateColorPhase();
+}
+
+static void updatePixelBnWColorTVRow (uint16_t compositeSignal)
+{
+	*getScanlineCurrent() = getScanlineColor(compositeSignal, g_aBnWColorTVCustom);
+	g_pVideoAddress++;
+	updateColorPhase();
+}
+
+static void blendRowTV (bgra_t* pRow, int count, bool bHalfScanlines)
+{
+	const uint32_t* pLine0 = (uint32_t*) pRow;
+	uint32_t* pLine1 = (uint32_t*) (pRow + 1*g_kFrameBufferWidth);
+	const uint32_t* pLine2 = (uint32_t*) (pRow + 2*g_kFrameBufferWidth);
+
+	if (bHalfScanlines)
+		g_pFuncBlendScanlineTVSingle(pLine1, pLine0, pLine2, count);
+	else
+		g_pFuncBlendScanlineTVDouble(pLine1, pLine0, pLine2, count);
+
+	// GH#650: Draw to final inbetween scanline to avoid residue from other video modes (eg. Amber->TV B&W)
+	if (g_nVideoClockVert == (VIDEO_SCANNER_Y_DISPLAY-1))
+	{
+		uint32_t* pLineNext = (uint32_t*) (pRow - 1*g_kFrameBufferWidth);
+		for (int i = 0; i < count; i++)
+			pLineNext[i] = (bHalfScanlines ? ((pLine0[i] & 0x00fcfcfc) >> 2) : ((pLine0[i] & 0x00fefefe) >> 1)) | ALPHA32_MASK;
+	}
+}
+
+//===========================================================================
+
+// Render a run of HGR bytes with the pixel function known at compile-time, so the 14 calls per byte get inlined
+template <UpdatePixelFunc_t updatePixel>
+static void updateHiresBytes(const uint8_t* pBytes, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		const uint8_t m = pBytes[i];
+		uint16_t bits = g_aPixelDoubleMaskHGR[m & 0x7F];
+		if (m & 0x80)
+			bits = (bits << 1) | g_nLastColumnPixelNTSC;
+		g_nLastColumnPixelNTSC = (bits >> 13) & 1;	// same as updatePixels()
+
+		for (int j = 0; j < 14; j++, bits >>= 1)
+			updatePixel(bits & 1);
+	}
+}
+
+static void updateHiresBytesSlow(const uint8_t* pBytes, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		const uint8_t m = pBytes[i];
+		uint16_t bits = g_aPixelDoubleMaskHGR[m & 0x7F];
+		if (m & 0x80)
+			bits = (bits << 1) | g_nLastColumnPixelNTSC;
+		updatePixels(bits);
+	}
+}
+
+//===========================================================================
+
+static void renderHiresBytes(UpdatePixelFunc_t updatePixel, const uint8_t* pBytes, int count)
+{
+	bgra_t* pRow = g_pVideoAddress;
+
+	if      (updatePixel == updatePixelHueColorTVSingleScanline) { updateHiresBytes<updatePixelHueColorTVRow>(pBytes, count); blendRowTV(pRow, count*14, true); }
+	else if (updatePixel == updatePixelHueColorTVDoubleScanline) { updateHiresBytes<updatePixelHueColorTVRow>(pBytes, count); blendRowTV(pRow, count*14, false); }
+	else if (updatePixel == updatePixelHueMonitorSingleScanline) updateHiresBytes<updatePixelHueMonitorSingleScanline>(pBytes, count);
+	else if (updatePixel == updatePixelHueMonitorDoubleScanline) updateHiresBytes<updatePixelHueMonitorDoubleScanline>(pBytes, count);
+	else if (updatePixel == updatePixelBnWColorTVSingleScanline) { updateHiresBytes<updatePixelBnWColorTVRow>(pBytes, count); blendRowTV(pRow, count*14, true); }
+	else if (updatePixel == updatePixelBnWColorTVDoubleScanline) { updateHiresBytes<updatePixelBnWColorTVRow>(pBytes, count); blendRowTV(pRow, count*14, false); }
+	else if (updatePixel == updatePixelBnWMonitorSingleScanline) updateHiresBytes<updatePixelBnWMonitorSingleScanline>(pBytes, count);
+	else if (updatePixel == updatePixelBnWMonitorDoubleScanline) updateHiresBytes<updatePixelBnWMonitorDoubleScanline>(pBytes, count);
+	else updateHiresBytesSlow(pBytes, count);
+}
+
+//===========================================================================
+
+// Render the HGR bytes fetched so far on this scanline
+// NB. Must be called before anything that changes how the rest of the scanline is rendered (video mode, style, scanner position)
+static void flushHiresLine(void)
+{
+	if (!g_bHiresLineBatched)
+		return;
+
+	g_bHiresLineBatched = false;
+
+	const UpdatePixelFunc_t updatePixel = GetColorBurst() ? g_pFuncUpdateHuePixel : g_pFuncUpdateBnWPixel;
+	const int count = g_nHiresLineBytes;
+	g_nHiresLineBytes = 0;
+
+	renderHiresBytes(updatePixel, g_aHiresLineBytes, count);
+
+	// See updateScreenSingleHires40() for the last hpos (GH#555)
+	if (count == VIDEO_SCANNER_MAX_HORZ - VIDEO_SCANNER_HORZ_START)
+		g_nLastColumnPixelNTSC = 0;
+}
+
 //===========================================================================
 void updateScreenDoubleHires40 (long cycles6502) // wsUpdateVideoHires0
 {
@@ -1262,7 +1578,7 @@ void updateScreenDoubleHires40 (long cycles6502) // wsUpdateVideoHires0
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
 				uint8_t  m     = pMain[0];
 				uint16_t bits  = g_aPixelDoubleMaskHGR[m & 0x7F]; // Optimization: hgrbits second 128 entries are mirror of first 128
 				updatePixels( bits );
@@ -1296,8 +1612,8 @@ void updateScreenDoubleHires80Simplified(long cycles6502) // wsUpdateVideoDblHir
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
 				uint16_t addr = getVideoScannerAddressHGR();
-				uint8_t a = *MemGetAuxPtr(addr);
-				uint8_t m = *MemGetMainPtr(addr);
+				uint8_t a = *getVideoAuxPtr(addr);
+				uint8_t m = *getVideoMainPtr(addr);
 
 				UpdateDHiResCell(g_nVideoClockHorz - VIDEO_SCANNER_HORZ_START, g_nVideoClockVert, addr, g_pVideoAddress, true, true);
 				g_pVideoAddress += 14;
@@ -1330,8 +1646,8 @@ void updateScreenDoubleHires80RGB (long cycles6502 ) // wsUpdateVideoDblHires
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
 				uint16_t addr = getVideoScannerAddressHGR();
-				uint8_t a = *MemGetAuxPtr(addr);
-				uint8_t m = *MemGetMainPtr(addr);
+				uint8_t a = *getVideoAuxPtr(addr);
+				uint8_t m = *getVideoMainPtr(addr);
 
 				if (RGB_IsMixModeInvertBit7())	// Invert high bit? (GH#633)
 				{
@@ -1380,8 +1696,8 @@ void updateScreenDoubleHires80 (long cycles6502 ) // wsUpdateVideoDblHires
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t  *pMain = MemGetMainPtr(addr);
-				uint8_t  *pAux  = MemGetAuxPtr (addr);
+				uint8_t  *pMain = getVideoMainPtr(addr);
+				uint8_t  *pAux  = getVideoAuxPtr (addr);
 
 				uint8_t m = pMain[0];
 				uint8_t a = pAux [0];
@@ -1417,7 +1733,7 @@ void updateScreenDoubleLores40 (long cycles6502) // wsUpdateVideo7MLores
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
 				uint8_t  m     = pMain[0];
 				uint16_t lo    = getLoResBits( m ); 
 				uint16_t bits  = g_aPixelDoubleMaskHGR[(0xFF & lo >> ((1 - (g_nVideoClockHorz & 1)) * 2)) & 0x7F]; // Optimization: hgrbits
@@ -1480,8 +1796,8 @@ void updateScreenDoubleLores80 (long cycles6502) // wsUpdateVideoDblLores
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
-				uint8_t *pAux  = MemGetAuxPtr (addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
+				uint8_t *pAux  = getVideoAuxPtr (addr);
 
 				uint8_t m = pMain[0];
 				uint8_t a = pAux [0];
@@ -1609,7 +1925,24 @@ void updateScreenSingleHires40 (long cycles6502)
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
+				// Whole scanline in this mode: fetch each byte on its cycle, but only render the row at the last hpos.
+				// Lines entered mid-way (eg. after a mode switch) and debugger stepping use the cycle-exact path below.
+				if (g_nVideoClockHorz == VIDEO_SCANNER_HORZ_START)
+				{
+					g_bHiresLineBatched = (g_nAppMode == MODE_RUNNING);
+					g_nHiresLineBytes = 0;
+				}
+
+				if (g_bHiresLineBatched)
+				{
+					g_aHiresLineBytes[g_nHiresLineBytes++] = *getVideoMainPtr(addr);
+					if (g_nVideoClockHorz == (VIDEO_SCANNER_MAX_HORZ-1))
+						flushHiresLine();
+					updateVideoScannerHorzEOL();
+					continue;
+				}
+
+				uint8_t *pMain = getVideoMainPtr(addr);
 				uint8_t  m     = pMain[0];
 				uint16_t bits  = g_aPixelDoubleMaskHGR[m & 0x7F]; // Optimization: hgrbits second 128 entries are mirror of first 128
 				if (m & 0x80)
@@ -1679,7 +2012,7 @@ void updateScreenSingleLores40 (long cycles6502)
 			}
 			else if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
 				uint8_t  m     = pMain[0];
 				uint16_t lo    = getLoResBits( m ); 
 				uint16_t bits  = lo >> ((1 - (g_nVideoClockHorz & 1)) * 2);
@@ -1706,7 +2039,7 @@ void updateScreenText40 (long cycles6502)
 		{
 			if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
 				uint8_t  m     = pMain[0];
 				uint8_t  c     = getCharSetBits(m);
 				uint16_t bits  = g_aPixelDoubleMaskHGR[c & 0x7F]; // Optimization: hgrbits second 128 entries are mirror of first 128
@@ -1738,7 +2071,7 @@ void updateScreenText40RGB(long cycles6502)
 		{
 			if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t* pMain = MemGetMainPtr(addr);
+				uint8_t* pMain = getVideoMainPtr(addr);
 				uint8_t  m = pMain[0];
 				uint8_t  c = getCharSetBits(m);
 
@@ -1771,8 +2104,8 @@ void updateScreenText80 (long cycles6502)
 		{
 			if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t *pMain = MemGetMainPtr(addr);
-				uint8_t *pAux  = MemGetAuxPtr (addr);
+				uint8_t *pMain = getVideoMainPtr(addr);
+				uint8_t *pAux  = getVideoAuxPtr (addr);
 
 				uint8_t m = pMain[0];
 				uint8_t a = pAux [0];
@@ -1815,8 +2148,8 @@ void updateScreenText80RGB(long cycles6502)
 		{
 			if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint8_t* pMain = MemGetMainPtr(addr);
-				uint8_t* pAux = MemGetAuxPtr(addr);
+				uint8_t* pMain = getVideoMainPtr(addr);
+				uint8_t* pAux = getVideoAuxPtr(addr);
 
 				uint8_t m = pMain[0];
 				uint8_t a = pAux[0];
@@ -1855,10 +2188,10 @@ void updateScreenSHR(long cycles6502)
 
 			if (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START)
 			{
-				uint32_t* pAux = (uint32_t*) MemGetAuxPtr(addr);	// 8 pixels (320 mode) / 16 pixels (640 mode)
+				uint32_t* pAux = (uint32_t*) getVideoAuxPtr(addr);	// 8 pixels (320 mode) / 16 pixels (640 mode)
 				uint32_t a = pAux[0];
 
-				uint8_t* pControl = MemGetAuxPtr(0x9D00 + g_nVideoClockVert);	// scan-line control byte
+				uint8_t* pControl = getVideoAuxPtr(0x9D00 + g_nVideoClockVert);	// scan-line control byte
 				uint8_t c = pControl[0];
 
 				bool is640Mode = !!(c & 0x80);
@@ -1906,6 +2239,9 @@ uint32_t*NTSC_VideoGetChromaTable( bool bHueTypeMonochrome, bool bMonitorTypeCol
 //===========================================================================
 void NTSC_VideoClockResync(const DWORD dwCyclesThisFrame)
 {
+	NTSCRenderLock lock;
+	flushLine();
+
 	g_nVideoClockVert = (uint16_t)(dwCyclesThisFrame / VIDEO_SCANNER_MAX_HORZ) % g_videoScannerMaxVert;
 	g_nVideoClockHorz = (uint16_t)(dwCyclesThisFrame % VIDEO_SCANNER_MAX_HORZ);
 }
@@ -1913,6 +2249,8 @@ void NTSC_VideoClockResync(const DWORD dwCyclesThisFrame)
 //===========================================================================
 uint16_t NTSC_VideoGetScannerAddress ( const ULONG uExecutedCycles )
 {
+	NTSCRenderLock lock;
+
 	if (g_bFullSpeed)
 	{
 		// Ensure that NTSC video-scanner gets updated during full-speed, so video-dependent Apple II code doesn't hang
@@ -1942,6 +2280,7 @@ uint16_t NTSC_VideoGetScannerAddress ( const ULONG uExecutedCycles )
 
 void NTSC_GetVideoVertHorzForDebugger(uint16_t& vert, uint16_t& horz)
 {
+	NTSCRenderLock lock;
 	ResetCyclesExecutedForDebugger();		// if in full-speed, then reset cycles so that CpuCalcCycles() doesn't ASSERT
 	NTSC_VideoGetScannerAddress(0);
 	vert = g_nVideoClockVert;
@@ -1958,6 +2297,9 @@ uint16_t NTSC_GetVideoVertForDebugger(void)
 //===========================================================================
 void NTSC_SetVideoTextMode( int cols )
 {
+	NTSCRenderLock lock;
+	flushLine();
+
 	if (GetVideo().GetVideoType() == VT_COLOR_VIDEOCARD_RGB)
 	{
 		if (cols == 40)
@@ -1972,8 +2314,11 @@ void NTSC_SetVideoTextMode( int cols )
 }
 
 //===========================================================================
-void NTSC_SetVideoMode( uint32_t uVideoModeFlags, bool bDelay/*=false*/ )
+// NB. bAltCharSet: passed in, as the render thread draws with the mode (and charset) of its copy of the video pages
+static void SetVideoMode( uint32_t uVideoModeFlags, bool bDelay, bool bAltCharSet )
 {
+	flushLine();
+
 	g_uNewVideoModeFlags = uVideoModeFlags;
 
 	if (uVideoModeFlags & VF_SHR)
@@ -1986,7 +2331,11 @@ void NTSC_SetVideoMode( uint32_t uVideoModeFlags, bool bDelay/*=false*/ )
 	if (g_pFuncUpdateGraphicsScreen == updateScreenSHR && !(uVideoModeFlags & VF_SHR))
 	{
 		// Was SHR mode, so clear the framebuffer to remove any SHR residue in the borders
-		GetVideo().ClearFrameBuffer();
+		if (g_pRenderFramebuffer)
+			std::fill((uint32_t*)g_pRenderFramebuffer, (uint32_t*)g_pRenderFramebuffer + GetVideo().GetFrameBufferWidth() * GetVideo().GetFrameBufferHeight(), OPAQUE_BLACK);
+		else
+			GetVideo().ClearFrameBuffer();
+		NTSC_VideoInvalidateScanlines();	// every scanline changed (and the cached ones are stale)
 	}
 
 	if (bDelay && !g_bFullSpeed)
@@ -1998,7 +2347,7 @@ void NTSC_SetVideoMode( uint32_t uVideoModeFlags, bool bDelay/*=false*/ )
 	}
 
 	g_nVideoMixed   = uVideoModeFlags & VF_MIXED;
-	g_nVideoCharSet = GetVideo().VideoGetSWAltCharSet() ? 1 : 0;
+	g_nVideoCharSet = bAltCharSet ? 1 : 0;
 
 	RGB_DisableTextFB();
 
@@ -2191,10 +2540,19 @@ void NTSC_SetVideoMode( uint32_t uVideoModeFlags, bool bDelay/*=false*/ )
 	}
 }
 
+void NTSC_SetVideoMode( uint32_t uVideoModeFlags, bool bDelay/*=false*/ )
+{
+	NTSCRenderLock lock;
+	SetVideoMode(uVideoModeFlags, bDelay, GetVideo().VideoGetSWAltCharSet());
+}
+
 //===========================================================================
 
 void NTSC_SetVideoStyle(void)
 {
+	NTSCRenderLock lock;
+	flushLine();
+
 	const bool half = GetVideo().IsVideoStyle(VS_HALF_SCANLINES);
 	const VideoRefreshRate_e refresh = GetVideo().GetVideoRefreshRate();
 	uint8_t r, g, b;
@@ -2286,6 +2644,7 @@ _mono:
 	}
 
 	ClearOverscanVideoArea();
+	NTSC_VideoInvalidateScanlines();	// new pixel tables
 }
 
 //===========================================================================
@@ -2294,19 +2653,26 @@ static void GenerateBaseColors(baseColors_t pBaseNtscColors);
 
 void NTSC_Destroy(void)
 {
+	NTSCRenderLock lock;
+
 	// After a VM restart, this will point to an old FrameBuffer
 	// - if it's now unmapped then this can cause a crash in NTSC_SetVideoMode()!
 	g_pVideoAddress = 0;
 	g_kFrameBufferWidth = 0;
+	g_bHiresLineBatched = false;
+	g_nHiresLineBytes = 0;
 	memset(g_pScanLines, 0, sizeof(g_pScanLines));
 }
 
 void NTSC_VideoInit( uint8_t* pFramebuffer ) // wsVideoInit
 {
+	NTSCRenderLock lock;
+
 	make_csbits();
 	GenerateVideoTables();
 	initPixelDoubleMasks();
 	initChromaPhaseTables();
+	initBlendScanlineFuncs();
 	updateMonochromeTables( 0xFF, 0xFF, 0xFF );
 
 	g_kFrameBufferWidth = GetVideo().GetFrameBufferWidth();
@@ -2320,6 +2686,9 @@ void NTSC_VideoInit( uint8_t* pFramebuffer ) // wsVideoInit
 	}
 
 	g_pVideoAddress = g_pScanLines[0];
+	g_bHiresLineBatched = false;
+	g_nHiresLineBytes = 0;
+	NTSC_VideoInvalidateScanlines();
 
 	g_pFuncUpdateTextScreen     = updateScreenText40;
 	g_pFuncUpdateGraphicsScreen = updateScreenText40;
@@ -2389,6 +2758,9 @@ void NTSC_VideoInit( uint8_t* pFramebuffer ) // wsVideoInit
 //===========================================================================
 void NTSC_VideoReinitialize( DWORD cyclesThisFrame, bool bInitVideoScannerAddress )
 {
+	NTSCRenderLock lock;
+	flushLine();
+
 	if (cyclesThisFrame >= g_videoScanner6502Cycles)
 	{
 		// Possible, since ContinueExecution() loop waits until: cycles > g_videoScanner6502Cycles && VBL
@@ -2405,6 +2777,7 @@ void NTSC_VideoReinitialize( DWORD cyclesThisFrame, bool bInitVideoScannerAddres
 //===========================================================================
 void NTSC_VideoInitAppleType ()
 {
+	NTSCRenderLock lock;
 	int model = GetApple2Type();
 
 	// anything other than low bit set means not II/II+ (TC: include Pravets machines too?)
@@ -2419,7 +2792,9 @@ void NTSC_VideoInitAppleType ()
 //===========================================================================
 void NTSC_VideoInitChroma()
 {
+	NTSCRenderLock lock;
 	initChromaPhaseTables();
+	NTSC_VideoInvalidateScanlines();
 }
 
 //===========================================================================
@@ -2432,11 +2807,221 @@ void NTSC_VideoInitChroma()
 
 //===========================================================================
 
+// What a whole scanline in this video mode is rendered from
+// . returns false if its scanlines aren't cached
+static bool getLineCacheSource(UpdateScreenFunc_t updateScreen, bool& bText, bool& bTextAddress)
+{
+	// SHR isn't an Apple II scanline, and RGB DHGR carries its mixed-mode state on from the previous scanline
+	if (updateScreen == updateScreenSHR || updateScreen == updateScreenDoubleHires80RGB)
+		return false;
+
+	// idealized HGR's vertical blend mixes in the next 2 scanlines
+	if (updateScreen == updateScreenHires40Simplified && GetVideo().IsVideoStyle(VS_COLOR_VERTICAL_BLEND))
+		return false;
+
+	bText = updateScreen == updateScreenText40 || updateScreen == updateScreenText40RGB
+		|| updateScreen == updateScreenText80 || updateScreen == updateScreenText80RGB;
+
+	bTextAddress = bText
+		|| updateScreen == updateScreenSingleLores40 || updateScreen == updateScreenSingleLores40Simplified
+		|| updateScreen == updateScreenDoubleLores40
+		|| updateScreen == updateScreenDoubleLores80 || updateScreen == updateScreenDoubleLores80Simplified;
+
+	return true;
+}
+
+// Start a visible scanline (Pre: g_nVideoClockHorz == VIDEO_SCANNER_HORZ_START)
+// . if its bytes, video mode & NTSC state are the same as its last render (which is still in the framebuffer) then it's skipped
+// . else it's rendered as normal, and cached
+// . the bytes are compared as fetched (rather than tracking the 6502's writes), so page flips & aux/main banking are covered
+static void startCachedLine(void)
+{
+	UpdateScreenFunc_t updateScreen = g_pFuncUpdateGraphicsScreen;
+	bool bText, bTextAddress;
+	if (!getLineCacheSource(updateScreen, bText, bTextAddress))
+		return;
+
+	if (g_nVideoMixed && g_nVideoClockVert >= VIDEO_SCANNER_Y_MIXED && !bText)
+	{
+		updateScreen = g_pFuncUpdateTextScreen;
+		if (!getLineCacheSource(updateScreen, bText, bTextAddress))
+			return;
+	}
+
+	g_nLineAddress = bTextAddress ? getVideoScannerAddressTXT() : getVideoScannerAddressHGR();
+	const uint8_t* pMain = getVideoMainPtr(g_nLineAddress);	// NB. a scanline's bytes never cross a page
+	const uint8_t* pAux = getVideoAuxPtr(g_nLineAddress);
+
+	const UpdatePixelFunc_t updatePixel = GetColorBurst() ? g_pFuncUpdateHuePixel : g_pFuncUpdateBnWPixel;
+	const uint32_t videoModeFlags = g_uNewVideoModeFlags & ~VF_PAGE2;	// the page is covered by the bytes
+	const csbits_t charSet = bText ? csbits : NULL;
+	const int videoCharSet = bText ? g_nVideoCharSet : 0;
+	const uint16_t textFlashMask = bText ? g_nTextFlashMask : 0;
+
+	LineCache_t& cache = g_aLineCache[g_nVideoClockVert];
+	g_bLineCached = true;
+	g_bLineUnchanged = cache.serial == g_nLineCacheSerial
+		&& cache.updateScreen == updateScreen
+		&& cache.videoModeFlags == videoModeFlags
+		&& cache.pVideoAddress == g_pVideoAddress
+		&& cache.updatePixel == updatePixel
+		&& cache.charSet == charSet
+		&& cache.videoCharSet == videoCharSet
+		&& cache.textFlashMask == textFlashMask
+		&& cache.signalBits == g_nSignalBitsNTSC
+		&& cache.colorPhase == g_nColorPhaseNTSC
+		&& cache.lastColumnPixel == g_nLastColumnPixelNTSC
+		&& memcmp(cache.bytesMain, pMain, LINE_CACHE_BYTES) == 0
+		&& memcmp(cache.bytesAux, pAux, LINE_CACHE_BYTES) == 0;
+
+	// The previous scanline's pixels are blended into this scanline's in-between line (line 0 blends with the border)
+	if (g_bLineUnchanged && (g_bLinePrevUnchanged || g_nVideoClockVert == 0))
+	{
+		g_bLineSkipped = true;
+		return;
+	}
+
+	cache.serial = g_nLineCacheSerial;
+	cache.updateScreen = updateScreen;
+	cache.videoModeFlags = videoModeFlags;
+	cache.pVideoAddress = g_pVideoAddress;
+	cache.updatePixel = updatePixel;
+	cache.charSet = charSet;
+	cache.videoCharSet = videoCharSet;
+	cache.textFlashMask = textFlashMask;
+	cache.signalBits = g_nSignalBitsNTSC;
+	cache.colorPhase = g_nColorPhaseNTSC;
+	cache.lastColumnPixel = g_nLastColumnPixelNTSC;
+	memcpy(cache.bytesMain, pMain, LINE_CACHE_BYTES);
+	memcpy(cache.bytesAux, pAux, LINE_CACHE_BYTES);
+}
+
+// Are the bytes fetched at hpos [x, x+n) of the current scanline still the same as its cache entry?
+// . and the ones either side, as the RGB cells look at their neighbours
+static bool isCachedLineUnchanged(int x, int n)
+{
+	const int first = x > 0 ? x - 1 : 0;
+	const int end = x + n < LINE_CACHE_BYTES ? x + n + 1 : LINE_CACHE_BYTES;
+	const LineCache_t& cache = g_aLineCache[g_nVideoClockVert];
+
+	return memcmp(cache.bytesMain + first, getVideoMainPtr(g_nLineAddress + first), end - first) == 0
+		&& memcmp(cache.bytesAux + first, getVideoAuxPtr(g_nLineAddress + first), end - first) == 0;
+}
+
+// The current scanline is no longer the same as its cache entry (eg. a byte changed, or a mode switch)
+// . if it was being skipped, then re-render the skipped part (from the bytes it was rendered from) for the NTSC state at this hpos
+static void uncacheLine(void)
+{
+	const bool bSkipped = g_bLineSkipped;
+	g_bLineCached = g_bLineUnchanged = g_bLineSkipped = false;
+
+	if (!bSkipped)
+		return;
+
+	const LineCache_t& cache = g_aLineCache[g_nVideoClockVert];
+	const int cycles = g_nVideoClockHorz - VIDEO_SCANNER_HORZ_START;
+
+	g_nVideoClockHorz = VIDEO_SCANNER_HORZ_START;
+	g_pVideoAddress = cache.pVideoAddress;
+	g_nSignalBitsNTSC = cache.signalBits;
+	g_nColorPhaseNTSC = cache.colorPhase;
+	g_nLastColumnPixelNTSC = cache.lastColumnPixel;
+
+	static uint8_t aLineMemMain[64*1024];
+	static uint8_t aLineMemAux[64*1024];
+	memcpy(aLineMemMain + g_nLineAddress, cache.bytesMain, LINE_CACHE_BYTES);
+	memcpy(aLineMemAux + g_nLineAddress, cache.bytesAux, LINE_CACHE_BYTES);
+
+	LPBYTE pVideoMemMain = g_pVideoMemMain;
+	LPBYTE pVideoMemAux = g_pVideoMemAux;
+	g_pVideoMemMain = aLineMemMain;
+	g_pVideoMemAux = aLineMemAux;
+	g_pFuncUpdateGraphicsScreen(cycles);
+	g_pVideoMemMain = pVideoMemMain;
+	g_pVideoMemAux = pVideoMemAux;
+}
+
+// Render the current scanline up to the video scanner's hpos
+// NB. Must be called before anything that changes how the rest of the scanline is rendered (video mode, style, scanner position)
+static void flushLine(void)
+{
+	uncacheLine();
+	flushHiresLine();
+}
+
+// As g_pFuncUpdateGraphicsScreen(), but each visible scanline goes through the scanline cache (see startCachedLine())
+// . a skipped scanline's last byte is still rendered by the video mode, so that the end of the scanline is too
+static void updateScreenLines(int cycles)
+{
+	while (cycles > 0)
+	{
+		if (g_nVideoClockHorz == VIDEO_SCANNER_HORZ_START && g_nVideoClockVert < VIDEO_SCANNER_Y_DISPLAY && g_nAppMode == MODE_RUNNING)
+			startCachedLine();
+
+		if (!g_bLineCached)
+		{
+			// Up to the start of the next scanline's bytes
+			int cyclesToLineStart = VIDEO_SCANNER_HORZ_START - g_nVideoClockHorz;
+			if (cyclesToLineStart <= 0)
+				cyclesToLineStart += VIDEO_SCANNER_MAX_HORZ;
+
+			const int n = cycles < cyclesToLineStart ? cycles : cyclesToLineStart;
+			g_pFuncUpdateGraphicsScreen(n);
+			cycles -= n;
+			continue;
+		}
+
+		// Up to the end of the scanline
+		const int cyclesToLineEnd = VIDEO_SCANNER_MAX_HORZ - g_nVideoClockHorz;
+		const int n = cycles < cyclesToLineEnd ? cycles : cyclesToLineEnd;
+		cycles -= n;
+
+		if (!isCachedLineUnchanged(g_nVideoClockHorz - VIDEO_SCANNER_HORZ_START, n))
+		{
+			uncacheLine();
+			g_pFuncUpdateGraphicsScreen(n);
+			continue;
+		}
+
+		if (n < cyclesToLineEnd)
+		{
+			if (g_bLineSkipped)
+				g_nVideoClockHorz += n;
+			else
+				g_pFuncUpdateGraphicsScreen(n);
+			continue;
+		}
+
+		// The last byte (& end of scanline), from the state before it
+		LineCache_t& cache = g_aLineCache[g_nVideoClockVert];
+		if (g_bLineSkipped)
+		{
+			g_nVideoClockHorz += n - 1;
+			g_pVideoAddress = cache.pVideoAddressEnd;
+			g_nSignalBitsNTSC = cache.signalBitsEnd;
+			g_nColorPhaseNTSC = cache.colorPhaseEnd;
+			g_nLastColumnPixelNTSC = cache.lastColumnPixelEnd;
+		}
+		else
+		{
+			g_pFuncUpdateGraphicsScreen(n - 1);
+			flushHiresLine();
+			cache.pVideoAddressEnd = g_pVideoAddress;
+			cache.signalBitsEnd = g_nSignalBitsNTSC;
+			cache.colorPhaseEnd = g_nColorPhaseNTSC;
+			cache.lastColumnPixelEnd = g_nLastColumnPixelNTSC;
+		}
+		g_pFuncUpdateGraphicsScreen(1);
+	}
+}
+
+//===========================================================================
+
 // Pre: cyclesLeftToUpdate = [0...g_videoScanner6502Cycles]
 // .  2-14: After one emulated 6502/65C02 opcode (optionally with IRQ)
 // . ~1000: After 1ms of Z80 emulation
 // . 17030: From NTSC_VideoRedrawWholeScreen()
-static void VideoUpdateCycles( int cyclesLeftToUpdate )
+static void VideoRenderCycles( int cyclesLeftToUpdate )
 {
 	const int cyclesToEndOfLine = VIDEO_SCANNER_MAX_HORZ - g_nVideoClockHorz;
 
@@ -2444,12 +3029,12 @@ static void VideoUpdateCycles( int cyclesLeftToUpdate )
 	{
 		const int cyclesToLine160 = VIDEO_SCANNER_MAX_HORZ * (VIDEO_SCANNER_Y_MIXED - g_nVideoClockVert - 1) + cyclesToEndOfLine;
 		int cycles = cyclesLeftToUpdate < cyclesToLine160 ? cyclesLeftToUpdate : cyclesToLine160;
-		g_pFuncUpdateGraphicsScreen(cycles);						// lines [currV...159]
+		updateScreenLines(cycles);						// lines [currV...159]
 		cyclesLeftToUpdate -= cycles;
 
 		const int cyclesFromLine160ToLine261 = g_videoScanner6502Cycles - (VIDEO_SCANNER_MAX_HORZ * VIDEO_SCANNER_Y_MIXED);
 		cycles = cyclesLeftToUpdate < cyclesFromLine160ToLine261 ? cyclesLeftToUpdate : cyclesFromLine160ToLine261;
-		g_pFuncUpdateGraphicsScreen(cycles);						// lines [160..191..261]
+		updateScreenLines(cycles);						// lines [160..191..261]
 		cyclesLeftToUpdate -= cycles;
 
 		// Any remaining cyclesLeftToUpdate: lines [0...currV)
@@ -2458,19 +3043,51 @@ static void VideoUpdateCycles( int cyclesLeftToUpdate )
 	{
 		const int cyclesToLine262 = VIDEO_SCANNER_MAX_HORZ * (g_videoScannerMaxVert - g_nVideoClockVert - 1) + cyclesToEndOfLine;
 		int cycles = cyclesLeftToUpdate < cyclesToLine262 ? cyclesLeftToUpdate : cyclesToLine262;
-		g_pFuncUpdateGraphicsScreen(cycles);						// lines [currV...261]
+		updateScreenLines(cycles);						// lines [currV...261]
 		cyclesLeftToUpdate -= cycles;
 
 		const int cyclesFromLine0ToLine159 = VIDEO_SCANNER_MAX_HORZ * VIDEO_SCANNER_Y_MIXED;
 		cycles = cyclesLeftToUpdate < cyclesFromLine0ToLine159 ? cyclesLeftToUpdate : cyclesFromLine0ToLine159;
-		g_pFuncUpdateGraphicsScreen(cycles);					// lines [0..159]
+		updateScreenLines(cycles);					// lines [0..159]
 		cyclesLeftToUpdate -= cycles;
 
 		// Any remaining cyclesLeftToUpdate: lines [160...currV)
 	}
 
 	if (cyclesLeftToUpdate)
-		g_pFuncUpdateGraphicsScreen(cyclesLeftToUpdate);
+		updateScreenLines(cyclesLeftToUpdate);
+}
+
+// Render-skip: the same video scanner state as VideoRenderCycles() (ie. the updateVideoScannerHorzEOL*() calls), without any pixel work
+static void VideoSkipCycles( int cyclesLeftToUpdate )
+{
+	const UINT horz = g_nVideoClockHorz + cyclesLeftToUpdate;
+	g_nVideoClockHorz = (uint16_t)(horz % VIDEO_SCANNER_MAX_HORZ);
+
+	const UINT lines = horz / VIDEO_SCANNER_MAX_HORZ;
+	if (!lines)
+		return;
+
+	const bool bSHR = g_pFuncUpdateGraphicsScreen == updateScreenSHR;
+	UINT vert = g_nVideoClockVert + lines;
+	while (vert >= g_videoScannerMaxVert)
+	{
+		vert -= g_videoScannerMaxVert;
+		if (!bSHR)
+			updateFlashRate();
+	}
+	g_nVideoClockVert = (uint16_t)vert;
+
+	if (g_nVideoClockVert < (bSHR ? VIDEO_SCANNER_Y_DISPLAY_IIGS : VIDEO_SCANNER_Y_DISPLAY))
+		updateVideoScannerAddress();	// keep g_pVideoAddress on the current line for NTSC_SetVideoMode()
+}
+
+static void VideoUpdateCycles( int cyclesLeftToUpdate )
+{
+	if (g_bVideoRenderSkip)
+		VideoSkipCycles(cyclesLeftToUpdate);
+	else
+		VideoRenderCycles(cyclesLeftToUpdate);
 }
 
 //===========================================================================
@@ -2501,6 +3118,8 @@ void NTSC_VideoUpdateCycles( UINT cycles6502 )
 //===========================================================================
 void NTSC_VideoRedrawWholeScreen( void )
 {
+	NTSCRenderLock lock;
+
 #ifdef _DEBUG
 	const uint16_t currVideoClockVert = g_nVideoClockVert;
 	const uint16_t currVideoClockHorz = g_nVideoClockHorz;
@@ -2509,13 +3128,16 @@ void NTSC_VideoRedrawWholeScreen( void )
 	// (GH#405) For full-speed: whole screen updates will occur periodically
 	// . The V/H pos will have been recalc'ed, so won't be continuous from previous (whole screen) update
 	// . So the redraw must start at H-pos=0 & with the usual reinit for the start of a new line
+	flushLine();
+
 	const uint16_t horz = g_nVideoClockHorz;
 	g_nVideoClockHorz = 0;
 	updateVideoScannerAddress();
 
-	VideoUpdateCycles(g_videoScanner6502Cycles);
+	// NB. Always rendered, even in render-skip mode
+	VideoRenderCycles(g_videoScanner6502Cycles);
 
-	VideoUpdateCycles(horz);	// Finally update to get to correct H-pos
+	VideoRenderCycles(horz);	// Finally update to get to correct H-pos
 
 #ifdef _DEBUG
 	_ASSERT(currVideoClockVert == g_nVideoClockVert);
@@ -2523,6 +3145,217 @@ void NTSC_VideoRedrawWholeScreen( void )
 #endif
 }
 
+//===========================================================================
+void NTSC_SetVideoRenderSkip(bool bSkip)
+{
+	NTSCRenderLock lock;
+	if (bSkip == g_bVideoRenderSkip)
+		return;
+
+	flushLine();
+	g_bVideoRenderSkip = bSkip;
+
+	if (!bSkip)
+	{
+		// The framebuffer is stale: the pixels of the current line restart at the left edge
+		// and the next frame is rendered in full
+		if (g_nVideoClockVert < VIDEO_SCANNER_Y_DISPLAY_IIGS)
+			updateVideoScannerAddress();
+		NTSC_VideoInvalidateScanlines();
+	}
+}
+
+bool NTSC_GetVideoRenderSkip(void)
+{
+	return g_bVideoRenderSkip;
+}
+
+//===========================================================================
+void NTSC_VideoGetDirtyScanlines(DirtyScanlines_t& dirty)
+{
+	NTSCRenderLock lock;
+	dirty = g_aDirtyScanlines;
+	g_aDirtyScanlines.reset();
+}
+
+//===========================================================================
+void NTSC_VideoInvalidateScanlines(void)
+{
+	NTSCRenderLock lock;
+
+	uncacheLine();	// the rest of the current scanline too
+
+	// Forget every cached scanline, so the next frame is fully rendered
+	if (++g_nLineCacheSerial == 0)
+		g_nLineCacheSerial = 1;	// 0 is never valid
+
+	g_aDirtyScanlines.set();
+}
+
+//===========================================================================
+NTSCRenderLock::NTSCRenderLock()
+	: m_bLocked(g_bRenderFrameStarted)
+{
+	// NB. Only the emulation thread starts (and ends) a frame, so it can't change behind its back - and the render thread only
+	// reads it while its frame is started
+	if (m_bLocked)
+		g_mutexRenderFrame.lock();
+}
+
+NTSCRenderLock::~NTSCRenderLock()
+{
+	if (m_bLocked)
+		g_mutexRenderFrame.unlock();
+}
+
+//===========================================================================
+void NTSC_VideoBeginRenderFrame(void)
+{
+	g_bRenderFrameStarted = true;
+}
+
+//===========================================================================
+void NTSC_VideoEndRenderFrame(void)
+{
+	g_bRenderFrameStarted = false;
+}
+
+//===========================================================================
+LPBYTE NTSC_VideoGetMainPtr(const WORD offset)
+{
+	return getVideoMainPtr(offset);
+}
+
+LPBYTE NTSC_VideoGetAuxPtr(const WORD offset)
+{
+	return getVideoAuxPtr(offset);
+}
+
+//===========================================================================
+
+// Exchange the current scanner state with 'state'
+static void SwapScannerState(ScannerState_t& state)
+{
+	std::swap(g_nVideoClockVert, state.videoClockVert);
+	std::swap(g_nVideoClockHorz, state.videoClockHorz);
+	std::swap(g_nVideoCharSet, state.videoCharSet);
+	std::swap(g_nVideoMixed, state.videoMixed);
+	std::swap(g_nHiresPage, state.hiresPage);
+	std::swap(g_nTextPage, state.textPage);
+	std::swap(g_bDelayVideoMode, state.delayVideoMode);
+	std::swap(g_uNewVideoModeFlags, state.newVideoModeFlags);
+	std::swap(g_pVideoAddress, state.pVideoAddress);
+	std::swap(g_pScanLines, state.pScanLines);
+	std::swap(g_pFuncUpdateTextScreen, state.funcUpdateTextScreen);
+	std::swap(g_pFuncUpdateGraphicsScreen, state.funcUpdateGraphicsScreen);
+	std::swap(g_nTextFlashCounter, state.textFlashCounter);
+	std::swap(g_nTextFlashMask, state.textFlashMask);
+	std::swap(g_nLastColumnPixelNTSC, state.lastColumnPixelNTSC);
+	std::swap(g_nColorBurstPixels, state.colorBurstPixels);
+	std::swap(g_nColorPhaseNTSC, state.colorPhaseNTSC);
+	std::swap(g_nSignalBitsNTSC, state.signalBitsNTSC);
+	std::swap(g_aHiresLineBytes, state.hiresLineBytes);
+	std::swap(g_nHiresLineBytes, state.nHiresLineBytes);
+	std::swap(g_bHiresLineBatched, state.hiresLineBatched);
+	std::swap(g_bLineCached, state.lineCached);
+	std::swap(g_bLineUnchanged, state.lineUnchanged);
+	std::swap(g_bLinePrevUnchanged, state.linePrevUnchanged);
+	std::swap(g_bLineSkipped, state.lineSkipped);
+	std::swap(g_nLineAddress, state.lineAddress);
+	std::swap(g_aDirtyScanlines, state.dirtyScanlines);
+	std::swap(g_pVideoMemMain, state.pVideoMemMain);
+	std::swap(g_pVideoMemAux, state.pVideoMemAux);
+
+	const int rgbTextFB = RGB_IsTextFB();
+	if (state.rgbTextFB)
+		RGB_EnableTextFB();
+	else
+		RGB_DisableTextFB();
+	state.rgbTextFB = rgbTextFB;
+}
+
+// Holds the lock with the render thread's scanner state swapped in, for one slice of its frame
+class RenderThreadSlice
+{
+public:
+	RenderThreadSlice(uint8_t* pFramebuffer)
+		: m_lock(g_mutexRenderFrame)
+	{
+		SwapScannerState(g_renderThreadState);
+		g_pRenderFramebuffer = pFramebuffer;
+	}
+
+	~RenderThreadSlice()
+	{
+		g_pRenderFramebuffer = NULL;
+		SwapScannerState(g_renderThreadState);
+	}
+
+private:
+	std::lock_guard<std::recursive_mutex> m_lock;
+};
+
+// Redraw the whole screen into pFramebuffer (same size as the Video framebuffer) from a MemCopyVideoPages() copy
+// NB. Called on the render thread after NTSC_VideoBeginRenderFrame()
+// . the frame is rendered a slice at a time, so the emulation thread's mode switches only wait for the current slice
+void NTSC_VideoRenderFrame(uint8_t* pFramebuffer, LPBYTE pMemMain, LPBYTE pMemAux, uint32_t uVideoMode, bool bAltCharSet, DWORD dwCyclesThisFrame)
+{
+	const int kSliceCycles = VIDEO_SCANNER_MAX_HORZ * 16;	// 16 scanlines
+	int cyclesLeftToRender;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(g_mutexRenderFrame);
+
+		// Start from the emulation thread's state, drawing into pFramebuffer instead of the Video framebuffer
+		ScannerState_t emulationThreadState = {};
+		SwapScannerState(emulationThreadState);
+		g_renderThreadState = emulationThreadState;
+		SwapScannerState(emulationThreadState);
+
+		const uint8_t* pVideoFramebuffer = GetVideo().GetFrameBuffer();
+		for (int y = 0; y < (VIDEO_SCANNER_Y_DISPLAY_IIGS*2); y++)
+			g_renderThreadState.pScanLines[y] = (bgra_t*) (pFramebuffer + ((const uint8_t*)g_pScanLines[y] - pVideoFramebuffer));
+
+		g_renderThreadState.pVideoAddress = NULL;	// set by updateVideoScannerAddress() below
+		g_renderThreadState.pVideoMemMain = pMemMain;
+		g_renderThreadState.pVideoMemAux = pMemAux;
+		g_renderThreadState.nHiresLineBytes = 0;
+		g_renderThreadState.hiresLineBatched = false;
+		g_renderThreadState.lineCached = g_renderThreadState.lineUnchanged = g_renderThreadState.linePrevUnchanged = false;
+		g_renderThreadState.lineSkipped = false;	// ie. the emulation thread's scanline isn't in pFramebuffer
+
+		RenderThreadSlice slice(pFramebuffer);
+
+		NTSC_VideoClockResync(dwCyclesThisFrame);
+		SetVideoMode(uVideoMode, false, bAltCharSet);
+
+		// As NTSC_VideoRedrawWholeScreen()
+		cyclesLeftToRender = g_videoScanner6502Cycles + g_nVideoClockHorz;
+		g_nVideoClockHorz = 0;
+		updateVideoScannerAddress();
+	}
+
+	while (cyclesLeftToRender)
+	{
+		RenderThreadSlice slice(pFramebuffer);
+
+		const int cycles = cyclesLeftToRender < kSliceCycles ? cyclesLeftToRender : kSliceCycles;
+		VideoRenderCycles(cycles);
+		cyclesLeftToRender -= cycles;
+
+		if (!cyclesLeftToRender)
+			flushLine();	// the last scanline, while pFramebuffer is still valid
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(g_mutexRenderFrame);
+
+	// The text flash isn't visible to the 6502, so it carries on from this frame (as for a redraw on the emulation thread)
+	g_nTextFlashCounter = g_renderThreadState.textFlashCounter;
+	g_nTextFlashMask = g_renderThreadState.textFlashMask;
+
+	NTSC_VideoInvalidateScanlines();	// the cached scanlines were drawn into the other framebuffer
+}
+
 //===========================================================================
 
 static bool CheckVideoTables2( eApple2Type type, uint32_t mode )
@@ -2689,6 +3522,8 @@ static void GenerateBaseColors(baseColors_t pBaseNtscColors)
 
 void NTSC_SetRefreshRate(VideoRefreshRate_e rate)
 {
+	NTSCRenderLock lock;
+
 	if (rate == VR_50HZ)
 	{
 		g_videoScannerMaxVert = VIDEO_SCANNER_MAX_VERT_PAL;
@@ -2723,6 +3558,7 @@ UINT NTSC_GetVideoLines(void)
 //   therefore g_nVideoClockVert/Horz will be behind, so correct 'cycleCurrentPos' by adding 'cycles'.
 UINT NTSC_GetCyclesUntilVBlank(int cycles)
 {
+	NTSCRenderLock lock;
 	const UINT cyclesPerFrames = NTSC_GetCyclesPerFrame();
 
 	if (g_bFullSpeed)
@@ -2738,18 +3574,22 @@ UINT NTSC_GetCyclesUntilVBlank(int cycles)
 
 bool NTSC_GetVblBar(void)
 {
+	NTSCRenderLock lock;
 	const UINT visibleScanLines = ((g_uNewVideoModeFlags & VF_SHR) == 0) ? VIDEO_SCANNER_Y_DISPLAY : VIDEO_SCANNER_Y_DISPLAY_IIGS;
 	return g_nVideoClockVert < visibleScanLines;
 }
 
 bool NTSC_IsVisible(void)
 {
+	NTSCRenderLock lock;
 	return NTSC_GetVblBar() && (g_nVideoClockHorz >= VIDEO_SCANNER_HORZ_START);
 }
 
 // For debugger
 uint16_t NTSC_GetScannerAddressAndData(uint32_t& data, int& dataSize)
 {
+	NTSCRenderLock lock;
+
 	if (g_uNewVideoModeFlags & VF_SHR)
 	{
 		uint16_t addr = getVideoScannerAddressSHR();
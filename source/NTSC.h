@@ -2,9 +2,15 @@
 
 #include "Video.h"	// NB. needed by GCC (for fwd enum declaration)
 
+#include <bitset>
+
 // Globals (Public)
 extern uint32_t g_nChromaSize;
 
+// One bit per Apple II scanline (200 to include SHR)
+// . scanline n is framebuffer rows 2n-1..2n+1 below the top border (the in-between rows are shared with its neighbours)
+typedef std::bitset<200> DirtyScanlines_t;
+
 // Prototypes (Public) ________________________________________________
 void NTSC_SetVideoMode(uint32_t uVideoModeFlags, bool bDelay=false);
 void NTSC_SetVideoStyle(void);
@@ -22,6 +28,34 @@ void NTSC_VideoInitChroma(void);
 void NTSC_VideoUpdateCycles(UINT cycles6502);
 void NTSC_VideoRedrawWholeScreen(void);
 
+// Render-skip: NTSC_VideoUpdateCycles() only advances the video scanner, no pixels are produced
+// . VBL, the scanner address & the floating bus stay cycle exact, so the CPU sees the same as in a rendered run
+// . NTSC_VideoRedrawWholeScreen() still renders (eg. for a final screenshot)
+void NTSC_SetVideoRenderSkip(bool bSkip);
+bool NTSC_GetVideoRenderSkip(void);
+void NTSC_VideoGetDirtyScanlines(DirtyScanlines_t& dirty);	// scanlines rendered since the last call (and clears them)
+void NTSC_VideoInvalidateScanlines(void);	// whole framebuffer changed: re-render & mark every scanline as dirty
+
+// Full-speed render thread (see FrameBase::VideoRedrawScreenDuringFullSpeed())
+// . from NTSC_VideoBeginRenderFrame() until NTSC_VideoEndRenderFrame(), the NTSC state is shared with the render thread,
+//   so the NTSC_*() entry points (and Video's mode switches) serialise on NTSCRenderLock, which is a no-op the rest of the time
+// . the render thread draws with its own scanner & mode state and its own copy of the video pages, a slice of the frame per lock
+class NTSCRenderLock
+{
+public:
+	NTSCRenderLock();
+	~NTSCRenderLock();
+
+private:
+	const bool m_bLocked;
+};
+
+void NTSC_VideoBeginRenderFrame(void);	// emulation thread, before handing the frame over
+void NTSC_VideoEndRenderFrame(void);	// emulation thread, once it has seen NTSC_VideoRenderFrame() return
+void NTSC_VideoRenderFrame(uint8_t* pFramebuffer, LPBYTE pMemMain, LPBYTE pMemAux, uint32_t uVideoMode, bool bAltCharSet, DWORD dwCyclesThisFrame);	// render thread
+LPBYTE NTSC_VideoGetMainPtr(const WORD offset);	// the memory the video scanner fetches from (the render thread's copy, while it draws)
+LPBYTE NTSC_VideoGetAuxPtr(const WORD offset);
+
 void NTSC_SetRefreshRate(VideoRefreshRate_e rate);
 UINT NTSC_GetCyclesPerFrame(void);
 UINT NTSC_GetCyclesPerLine(void);
@@ -30,6 +30,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 #include "ParallelPrinter.h"
 #include "Core.h"
+#include "CPU.h"
 #include "Memory.h"
 #include "Pravets.h"
 #include "Registry.h"
@@ -66,6 +67,9 @@ bool ParallelPrinterCard::CheckPrint(void)
 			m_file = fopen(ParallelPrinterCard::GetFilename().c_str(), "ab");
 		else
 			m_file = fopen(ParallelPrinterCard::GetFilename().c_str(), "wb");
+
+		if (m_file != NULL)
+			CpuUpdateDue();	// the idle limit is armed (see GetCyclesUntilUpdate())
 	}
 	return (m_file != NULL);
 }
@@ -108,6 +112,17 @@ void ParallelPrinterCard::Update(const ULONG nExecutedCycles)
 	}
 }
 
+//===========================================================================
+ULONG ParallelPrinterCard::GetCyclesUntilUpdate(void)
+{
+	if (m_file == NULL)
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	// Due when the idle limit expires
+	const DWORD idleLimit = ParallelPrinterCard::GetIdleLimit () * 710000;
+	return (m_inactivity < idleLimit) ? idleLimit - m_inactivity + 1 : 1;
+}
+
 //===========================================================================
 void ParallelPrinterCard::Reset(const bool powerCycle)
 {
@@ -23,6 +23,7 @@ public:
 	virtual void Destroy(void);
 	virtual void Reset(const bool powerCycle);
 	virtual void Update(const ULONG nExecutedCycles);
+	virtual ULONG GetCyclesUntilUpdate(void);
 	virtual void InitializeIO(LPBYTE pCxRomPeripheral);
 
 	static BYTE __stdcall IORead(WORD pc, WORD addr, BYTE bWrite, BYTE value, ULONG nExecutedCycles);
@@ -117,5 +117,8 @@ void Clock_Util_ConvertTimeToProdos( tm *pTime, unsigned char *pProDosBytes4_ )
 void Clock_Generic_UpdateProDos()
 {
 	tm* pTime = Clock_Util_GetTime();
-	Clock_Util_ConvertTimeToProdos( pTime, &mem[ 0xBF90 ] ); // ProDos date/time buffer
+	BYTE prodosBytes[4];
+	Clock_Util_ConvertTimeToProdos( pTime, prodosBytes );
+	for (WORD i = 0; i < sizeof(prodosBytes); i++)
+		WriteByteToMemory( 0xBF90 + i, prodosBytes[i] ); // ProDos date/time buffer
 }
@@ -3,8 +3,9 @@
 #include "StdAfx.h"
 
 #include "RGBMonitor.h"
-#include "Memory.h" // MemGetMainPtr() MemGetAuxPtr()
+#include "Memory.h" // NTSC_VideoGetMainPtr() NTSC_VideoGetAuxPtr()
 #include "Interface.h"
+#include "NTSC.h" // NTSCRenderLock, NTSC_VideoGetMainPtr(), NTSC_VideoGetAuxPtr()
 #include "YamlHelper.h"
 
 
@@ -584,85 +585,32 @@ static void CopySource(int w, int h, int sx, int sy, bgra_t *pVideoAddress, cons
 
 //===========================================================================
 
-#define HIRES_COLUMN_OFFSET (((byteval1 & 0xE0) << 2) | ((byteval3 & 0x03) << 5))	// (prevHighBit | last 2 pixels | next 2 pixels) * HIRES_COLUMN_UNIT_SIZE
+// Pixel span tables: a byte (& the neighbour bits which affect its colours) -> its pixels
+// . so a cell is just 2 rows of 14 pixels to copy
+// . built (on the emulation thread) when the source image or the palette changes, so they are read-only while drawing
 
-void UpdateHiResCell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
-{
-	uint8_t *pMain = MemGetMainPtr(addr);
-	BYTE byteval1 = (x >  0) ? *(pMain-1) : 0;
-	BYTE byteval2 =            *(pMain);
-	BYTE byteval3 = (x < 39) ? *(pMain+1) : 0;
+const int SPAN_WIDTH = 14;		// 7 HGR pixels, each 2 pixels wide
+const int DHGR_SPAN_WIDTH = 7;
 
-	if (GetVideo().GetVideoMode() & VF_DHIRES)	// ie. VF_DHIRES=1, VF_HIRES=1, VF_80COL=0 - NTSC.cpp refers to this as "DoubleHires40"
-	{
-		byteval1 &= 0x7f;
-		byteval2 &= 0x7f;
-		byteval3 &= 0x7f;
-	}
+// [prevHighBit | last 2 pixels | next 2 pixels][x & 1][byte]: the HGR source image through the palette
+static UINT32 g_aHiresSpans[HIRES_NUMBER_COLUMNS][2][256][SPAN_WIDTH];
 
-	if (GetVideo().IsVideoStyle(VS_COLOR_VERTICAL_BLEND))
-	{
-		CopyMixedSource(x, y, SRCOFFS_HIRES+HIRES_COLUMN_OFFSET+((x & 1)*HIRES_COLUMN_SUBUNIT_SIZE), (int)byteval2, pVideoAddress);
-	}
-	else
-	{
-		CopySource(14,2, SRCOFFS_HIRES+HIRES_COLUMN_OFFSET+((x & 1)*HIRES_COLUMN_SUBUNIT_SIZE), (int)byteval2, pVideoAddress);
-	}
-}
-
-//===========================================================================
-
-#define COLOR  ((xpixel + PIXEL) & 3)
-#define VALUE  (dwordval >> (4 + PIXEL - COLOR))
-
-void UpdateDHiResCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress, bool updateAux, bool updateMain)
-{
-	const int xpixel = x * 14;
+// RGB videocards HGR: [x & 1][previous byte's last pixel | byte | next byte's first pixel]
+#define HIRES_RGB_SPAN_INDEX(prev, byteval, next) ((((prev) >> 6) & 1) | ((byteval) << 1) | (((next) & 1) << 9))
+static UINT32 g_aHiresRGBSpans[2][1024][SPAN_WIDTH];
 
-	uint8_t* pAux = MemGetAuxPtr(addr);
-	uint8_t* pMain = MemGetMainPtr(addr);
+// RGB videocards DHGR: 4 bytes (aux, main, aux, main) make 7 colour pixels of 4 bits, each 4 pixels wide
+// . a colour quarter (ie. byte) is drawn from the bits of the colour pixels it overlaps: [start, start + width) of the 28 bits
+static const int kDHiresRGBQuarterStart[4] = { 0, 4, 12, 20 };
+static const int kDHiresRGBQuarterWidth[4] = { 8, 12, 12, 8 };
+static const int kDHiresRGBQuarterOffset[4] = { 0, 1 << 8, (1 << 8) + (1 << 12), (1 << 8) + 2 * (1 << 12) };
+static UINT32 g_aDHiresRGBColorSpans[2 * (1 << 8) + 2 * (1 << 12)][DHGR_SPAN_WIDTH];
+static UINT32 g_aDHiresRGBMonoSpans[128][DHGR_SPAN_WIDTH];
 
-	BYTE byteval1 = (x > 0) ? *(pMain - 1) : 0;
-	BYTE byteval2 = *pAux;
-	BYTE byteval3 = *pMain;
-	BYTE byteval4 = (x < 39) ? *(pAux + 1) : 0;
-
-	DWORD dwordval = (byteval1 & 0x70) | ((byteval2 & 0x7F) << 7) |
-		((byteval3 & 0x7F) << 14) | ((byteval4 & 0x07) << 21);
-
-#define PIXEL  0
-	if (updateAux)
-	{
-		CopySource(7, 2, SRCOFFS_DHIRES + 10 * HIBYTE(VALUE) + COLOR, LOBYTE(VALUE), pVideoAddress);
-		pVideoAddress += 7;
-	}
-#undef PIXEL
-
-#define PIXEL  7
-	if (updateMain)
-	{
-		CopySource(7, 2, SRCOFFS_DHIRES + 10 * HIBYTE(VALUE) + COLOR, LOBYTE(VALUE), pVideoAddress);
-	}
-#undef PIXEL
-}
-
-//===========================================================================
-// RGB videocards HGR
-
-void UpdateHiResRGBCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress)
+// The 14 pixels of one cell of a 2-byte block (byteval2 & byteval3), with a byte either side
+static void HiResRGBPixels(int xoffset, uint8_t byteval1, uint8_t byteval2, uint8_t byteval3, uint8_t byteval4, UINT32* pDst)
 {
-	const int xpixel = x * 14;
-	int xoffset = x & 1; // offset to start of the 2 bytes
-	addr -= xoffset;
-
-	uint8_t* pMain = MemGetMainPtr(addr);
-
 	// We need all 28 bits because each pixel needs a three bit evaluation
-	uint8_t byteval1 = (x < 2 ? 0 : *(pMain - 1));
-	uint8_t byteval2 = *pMain;
-	uint8_t byteval3 = *(pMain + 1);
-	uint8_t byteval4 = (x >= 38 ? 0 : *(pMain + 2));
-	
 	// all 28 bits chained
 	DWORD dwordval = (byteval1 & 0x7F) | ((byteval2 & 0x7F) << 7) | ((byteval3 & 0x7F) << 14) | ((byteval4 & 0x7F) << 21);
 
@@ -697,8 +645,6 @@ void UpdateHiResRGBCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress)
 	// In all other cases, it's black if 0 and white if 1
 	// The value of 'color' is defined on a 2-bits basis
 
-	UINT32* pDst = (UINT32*)pVideoAddress;
-
 	if (xoffset)
 	{
 		// Second byte of the 14 pixels block
@@ -725,69 +671,167 @@ void UpdateHiResRGBCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress)
 		// Next pixel
 		dwordval = dwordval >> 1;
 	}
+}
 
-	const bool bIsHalfScanLines = GetVideo().IsVideoStyle(VS_HALF_SCANLINES);
+static void CreateSpanTables(void)
+{
+	if (!g_pPaletteRGB || !g_aSourceStartofLine[0])
+		return;	// not both set up yet: built by the other of VideoInitializeOriginal() & VideoSwitchVideocardPalette()
+
+	NTSCRenderLock lock;	// the full-speed render thread may be drawing with them
+
+	const UINT32* pPalette = reinterpret_cast<const UINT32*>(g_pPaletteRGB);
+
+	for (int column = 0; column < HIRES_NUMBER_COLUMNS; column++)
+	{
+		for (int odd = 0; odd < 2; odd++)
+		{
+			for (int byteval = 0; byteval < 256; byteval++)
+			{
+				const BYTE* pSrc = g_aSourceStartofLine[byteval] + SRCOFFS_HIRES + column * HIRES_COLUMN_UNIT_SIZE + odd * HIRES_COLUMN_SUBUNIT_SIZE;
+				for (int i = 0; i < SPAN_WIDTH; i++)
+					g_aHiresSpans[column][odd][byteval][i] = pPalette[pSrc[i]];
+			}
+		}
+	}
+
+	for (int index = 0; index < 1024; index++)
+	{
+		const uint8_t prev = (index & 1) << 6;
+		const uint8_t byteval = (index >> 1) & 0xFF;
+		const uint8_t next = (index >> 9) & 1;
+		HiResRGBPixels(0, prev, byteval, next, 0, g_aHiresRGBSpans[0][index]);
+		HiResRGBPixels(1, 0, prev, byteval, next, g_aHiresRGBSpans[1][index]);
+	}
+
+	for (int quarter = 0; quarter < 4; quarter++)
+	{
+		for (DWORD value = 0; value < (1u << kDHiresRGBQuarterWidth[quarter]); value++)
+		{
+			const DWORD dwordval = value << kDHiresRGBQuarterStart[quarter];
+			for (int i = 0; i < DHGR_SPAN_WIDTH; i++)
+			{
+				const int bits = (dwordval >> (4 * ((7 * quarter + i) / 4))) & 0xF;
+				const int color = ((bits & 7) << 1) | ((bits & 8) >> 3); // DHGR colors are rotated 1 bit to the right
+				g_aDHiresRGBColorSpans[kDHiresRGBQuarterOffset[quarter] + value][i] = pPalette[12 + color];
+			}
+		}
+	}
 
-	// Second line
-	UINT32* pSrc = (UINT32*)pVideoAddress;
-	pDst = pSrc - GetVideo().GetFrameBufferWidth();
-	if (bIsHalfScanLines)
+	for (int bits = 0; bits < 128; bits++)
 	{
-		// Scanlines
-		std::fill(pDst, pDst + 14, OPAQUE_BLACK);
+		for (int i = 0; i < DHGR_SPAN_WIDTH; i++)
+			g_aDHiresRGBMonoSpans[bits][i] = pPalette[12 + ((bits >> i) & 1) * 15];
 	}
+}
+
+// Both rows of a cell (the 2nd is black for 50% scan lines)
+static void CopySpan(const UINT32* pSpan, bgra_t* pVideoAddress)
+{
+	UINT32* pDst = (UINT32*) pVideoAddress;
+	memcpy(pDst, pSpan, SPAN_WIDTH * sizeof(UINT32));
+
+	pDst -= GetVideo().GetFrameBufferWidth();
+	if (GetVideo().IsVideoStyle(VS_HALF_SCANLINES))
+		std::fill(pDst, pDst + SPAN_WIDTH, OPAQUE_BLACK);
 	else
+		memcpy(pDst, pSpan, SPAN_WIDTH * sizeof(UINT32));
+}
+
+//===========================================================================
+
+#define HIRES_COLUMN_OFFSET (((byteval1 & 0xE0) << 2) | ((byteval3 & 0x03) << 5))	// (prevHighBit | last 2 pixels | next 2 pixels) * HIRES_COLUMN_UNIT_SIZE
+
+void UpdateHiResCell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
+{
+	uint8_t *pMain = NTSC_VideoGetMainPtr(addr);
+	BYTE byteval1 = (x >  0) ? *(pMain-1) : 0;
+	BYTE byteval2 =            *(pMain);
+	BYTE byteval3 = (x < 39) ? *(pMain+1) : 0;
+
+	if (GetVideo().GetVideoMode() & VF_DHIRES)	// ie. VF_DHIRES=1, VF_HIRES=1, VF_80COL=0 - NTSC.cpp refers to this as "DoubleHires40"
+	{
+		byteval1 &= 0x7f;
+		byteval2 &= 0x7f;
+		byteval3 &= 0x7f;
+	}
+
+	if (GetVideo().IsVideoStyle(VS_COLOR_VERTICAL_BLEND))
 	{
-		for (int i = 0; i < 14; i++)
-			*(pDst + i) = *(pSrc + i);
+		CopyMixedSource(x, y, SRCOFFS_HIRES+HIRES_COLUMN_OFFSET+((x & 1)*HIRES_COLUMN_SUBUNIT_SIZE), (int)byteval2, pVideoAddress);
+	}
+	else
+	{
+		const int column = ((byteval1 & 0xE0) >> 3) | (byteval3 & 0x03);	// = HIRES_COLUMN_OFFSET / HIRES_COLUMN_UNIT_SIZE
+		CopySpan(g_aHiresSpans[column][x & 1][byteval2], pVideoAddress);
 	}
 }
 
-static bool g_dhgrLastCellIsColor = true;
-static int g_dhgrLastBit = 0;
+//===========================================================================
 
-void UpdateDHiResCellRGB(int x, int y, uint16_t addr, bgra_t* pVideoAddress, bool isMixMode, bool isBit7Inversed)
+#define COLOR  ((xpixel + PIXEL) & 3)
+#define VALUE  (dwordval >> (4 + PIXEL - COLOR))
+
+void UpdateDHiResCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress, bool updateAux, bool updateMain)
 {
 	const int xpixel = x * 14;
-	int xoffset = x & 1; // offset to start of the 2 bytes
-	addr -= xoffset;
 
-	uint8_t* pAux = MemGetAuxPtr(addr);
-	uint8_t* pMain = MemGetMainPtr(addr);
+	uint8_t* pAux = NTSC_VideoGetAuxPtr(addr);
+	uint8_t* pMain = NTSC_VideoGetMainPtr(addr);
 
-	// We need all 28 bits because one 4-bits pixel overlaps two 14-bits cells
-	uint8_t byteval1 = *pAux;
-	uint8_t byteval2 = *pMain;
-	uint8_t byteval3 = *(pAux + 1);
-	uint8_t byteval4 = *(pMain + 1);
+	BYTE byteval1 = (x > 0) ? *(pMain - 1) : 0;
+	BYTE byteval2 = *pAux;
+	BYTE byteval3 = *pMain;
+	BYTE byteval4 = (x < 39) ? *(pAux + 1) : 0;
 
-	// all 28 bits chained
-	DWORD dwordval = (byteval1 & 0x7F) | ((byteval2 & 0x7F) << 7) | ((byteval3 & 0x7F) << 14) | ((byteval4 & 0x7F) << 21);
+	DWORD dwordval = (byteval1 & 0x70) | ((byteval2 & 0x7F) << 7) |
+		((byteval3 & 0x7F) << 14) | ((byteval4 & 0x07) << 21);
 
-	// Extraction of 7 color pixels and 7x4 bits
-	int bits[7];
-	UINT32 colors[7];
-	int color = 0;
-	DWORD dwordval_tmp = dwordval;
-	for (int i = 0; i < 7; i++)
+#define PIXEL  0
+	if (updateAux)
 	{
-		bits[i] = dwordval_tmp & 0xF;
-		color = ((bits[i] & 7) << 1) | ((bits[i] & 8) >> 3); // DHGR colors are rotated 1 bit to the right
-		colors[i] = *reinterpret_cast<const UINT32*>(&g_pPaletteRGB[12 + color]);
-		dwordval_tmp >>= 4;
+		CopySource(7, 2, SRCOFFS_DHIRES + 10 * HIBYTE(VALUE) + COLOR, LOBYTE(VALUE), pVideoAddress);
+		pVideoAddress += 7;
 	}
-	UINT32 bw[2];
-	bw[0] = *reinterpret_cast<const UINT32*>(&g_pPaletteRGB[12 + 0]);
-	bw[1] = *reinterpret_cast<const UINT32*>(&g_pPaletteRGB[12 + 15]);
+#undef PIXEL
 
-	if (isBit7Inversed)
+#define PIXEL  7
+	if (updateMain)
 	{
-		// Invert mixed mode detection
-		byteval1 = ~byteval1;
-		byteval2 = ~byteval2;
-		byteval3 = ~byteval3;
-		byteval4 = ~byteval4;
+		CopySource(7, 2, SRCOFFS_DHIRES + 10 * HIBYTE(VALUE) + COLOR, LOBYTE(VALUE), pVideoAddress);
 	}
+#undef PIXEL
+}
+
+//===========================================================================
+// RGB videocards HGR
+
+void UpdateHiResRGBCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress)
+{
+	// Only the adjacent pixels of the neighbour bytes matter
+	uint8_t* pMain = NTSC_VideoGetMainPtr(addr);
+	const uint8_t prev = (x > 0) ? *(pMain - 1) : 0;
+	const uint8_t next = (x < 39) ? *(pMain + 1) : 0;
+
+	CopySpan(g_aHiresRGBSpans[x & 1][HIRES_RGB_SPAN_INDEX(prev, *pMain, next)], pVideoAddress);
+}
+
+static bool g_dhgrLastCellIsColor = true;
+static int g_dhgrLastBit = 0;
+
+void UpdateDHiResCellRGB(int x, int y, uint16_t addr, bgra_t* pVideoAddress, bool isMixMode, bool isBit7Inversed)
+{
+	int xoffset = x & 1; // offset to start of the 2 bytes
+	addr -= xoffset;
+
+	uint8_t* pAux = NTSC_VideoGetAuxPtr(addr);
+	uint8_t* pMain = NTSC_VideoGetMainPtr(addr);
+
+	// We need all 28 bits because one 4-bits pixel overlaps two 14-bits cells
+	const uint8_t bytes[4] = { *pAux, *pMain, *(pAux + 1), *(pMain + 1) };
+
+	// all 28 bits chained
+	const DWORD dwordval = (bytes[0] & 0x7F) | ((bytes[1] & 0x7F) << 7) | ((bytes[2] & 0x7F) << 14) | ((bytes[3] & 0x7F) << 21);
 
 	// RGB DHGR is quite a mess:
 	// Color mode is a real 140x192 RGB mode with no color fringe (ref. patent US4631692, "THE 140x192 VIDEO MODE")
@@ -800,162 +844,40 @@ void UpdateDHiResCellRGB(int x, int y, uint16_t addr, bgra_t* pVideoAddress, boo
 	//
 	// (Tested on Le Chat Mauve IIc adapter, which was made under patent of Video-7)
 
-	UINT32* pDst = (UINT32*)pVideoAddress;
+	UINT32 pixels[SPAN_WIDTH];
 
-	if (xoffset == 0)	// First cell
+	for (int half = 0; half < 2; half++)
 	{
-		if ((byteval1 & 0x80) || !isMixMode)
-		{
-			// Color
-			
-			// Color cell 0
-			*(pDst++) = colors[0];
-			*(pDst++) = colors[0];
-			*(pDst++) = colors[0];
-			*(pDst++) = colors[0];
-			// Color cell 1
-			*(pDst++) = colors[1];
-			*(pDst++) = colors[1];
-			*(pDst++) = colors[1];
-			
-			dwordval >>= 7;
-			g_dhgrLastCellIsColor = true;
-		}
-		else
-		{
-			// BW
-			for (int i = 0; i < 7; i++)
-			{
-				g_dhgrLastBit = dwordval & 1;
-				*(pDst++) = bw[g_dhgrLastBit];
-				dwordval >>= 1;
-			}
-			g_dhgrLastCellIsColor = false;
-		}
+		const int quarter = 2 * xoffset + half;
+		UINT32* pDst = pixels + half * DHGR_SPAN_WIDTH;
 
-		if ((byteval2 & 0x80) || !isMixMode)
-		{
-			// Remaining of color cell 1
-			if (g_dhgrLastCellIsColor)
-			{
-				*(pDst++) = colors[1];
-			}
-			else
-			{
-				// Repeat last BW bit once
-				*(pDst++) = bw[g_dhgrLastBit];
-			}
-			// Color cell 2
-			*(pDst++) = colors[2];
-			*(pDst++) = colors[2];
-			*(pDst++) = colors[2];
-			*(pDst++) = colors[2];
-			// Color cell 3
-			*(pDst++) = colors[3];
-			*(pDst++) = colors[3];
-			g_dhgrLastCellIsColor = true;
-		}
-		else
-		{
-			for (int i = 0; i < 7; i++)
-			{
-				g_dhgrLastBit = dwordval & 1;
-				*(pDst++) = bw[g_dhgrLastBit];
-				dwordval >>= 1;
-			}
-			g_dhgrLastCellIsColor = false;
-		}
-	}
-	else  // Second cell
-	{
-		dwordval >>= 14;
+		// Invert mixed mode detection?
+		const uint8_t byteval = isBit7Inversed ? ~bytes[quarter] : bytes[quarter];
 
-		if ((byteval3 & 0x80) || !isMixMode)
-		{
-			// Remaining of color cell 3
-			if (g_dhgrLastCellIsColor)
-			{
-				*(pDst++) = colors[3];
-				*(pDst++) = colors[3];
-			}
-			else
-			{
-				// Repeat last BW bit twice
-				*(pDst++) = bw[g_dhgrLastBit];
-				*(pDst++) = bw[g_dhgrLastBit];
-			}
-			// Color cell 4
-			*(pDst++) = colors[4];
-			*(pDst++) = colors[4];
-			*(pDst++) = colors[4];
-			*(pDst++) = colors[4];
-			// Color cell 5
-			*(pDst++) = colors[5];
-			
-			dwordval >>= 7;
-			g_dhgrLastCellIsColor = true;
-		}
-		else
+		if ((byteval & 0x80) || !isMixMode)
 		{
-			for (int i = 0; i < 7; i++)
-			{
-				g_dhgrLastBit = dwordval & 1;
-				*(pDst++) = bw[g_dhgrLastBit];
-				dwordval >>= 1;
-			}
-			g_dhgrLastCellIsColor = false;
-		}
+			// Color: starts with the remaining of the previous byte's last color cell (0-3 pixels)
+			const DWORD value = (dwordval >> kDHiresRGBQuarterStart[quarter]) & ((1 << kDHiresRGBQuarterWidth[quarter]) - 1);
+			memcpy(pDst, g_aDHiresRGBColorSpans[kDHiresRGBQuarterOffset[quarter] + value], DHGR_SPAN_WIDTH * sizeof(UINT32));
 
-		if ((byteval4 & 0x80) || !isMixMode)
-		{
-			// Remaining of color cell 5
-			if (g_dhgrLastCellIsColor)
-			{
-				*(pDst++) = colors[5];
-				*(pDst++) = colors[5];
-				*(pDst++) = colors[5];
-			}
-			else
+			if (!g_dhgrLastCellIsColor)
 			{
-				// Repeat last BW bit three times
-				*(pDst++) = bw[g_dhgrLastBit];
-				*(pDst++) = bw[g_dhgrLastBit];
-				*(pDst++) = bw[g_dhgrLastBit];
+				// Repeat last BW bit instead
+				std::fill(pDst, pDst + quarter, g_aDHiresRGBMonoSpans[g_dhgrLastBit ? 0x7F : 0][0]);
 			}
-			// Color cell 6
-			*(pDst++) = colors[6];
-			*(pDst++) = colors[6];
-			*(pDst++) = colors[6];
-			*(pDst++) = colors[6];
 			g_dhgrLastCellIsColor = true;
 		}
 		else
 		{
-			for (int i = 0; i < 7; i++)
-			{
-				g_dhgrLastBit = dwordval & 1;
-				*(pDst++) = bw[g_dhgrLastBit];
-				dwordval >>= 1;
-			}
+			// BW
+			const int bits = (dwordval >> (7 * quarter)) & 0x7F;
+			memcpy(pDst, g_aDHiresRGBMonoSpans[bits], DHGR_SPAN_WIDTH * sizeof(UINT32));
+			g_dhgrLastBit = bits >> 6;
 			g_dhgrLastCellIsColor = false;
 		}
 	}
 
-	const bool bIsHalfScanLines = GetVideo().IsVideoStyle(VS_HALF_SCANLINES);
-
-	// Second line
-	UINT32* pSrc = (UINT32*)pVideoAddress ;
-	pDst = pSrc - GetVideo().GetFrameBufferWidth();
-	if (bIsHalfScanLines)
-	{
-		// Scanlines
-		std::fill(pDst, pDst + 14, OPAQUE_BLACK);
-	}
-	else
-	{
-		for (int i = 0; i < 14; i++)
-			*(pDst + i) = *(pSrc + i);
-	}
+	CopySpan(pixels, pVideoAddress);
 }
 
 #if 1
@@ -964,8 +886,8 @@ int UpdateDHiRes160Cell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 {
 	const int xpixel = x*16;
 
-	uint8_t *pAux = MemGetAuxPtr(addr);
-	uint8_t *pMain = MemGetMainPtr(addr);
+	uint8_t *pAux = NTSC_VideoGetAuxPtr(addr);
+	uint8_t *pMain = NTSC_VideoGetMainPtr(addr);
 
 	BYTE byteval1 = (x >  0) ? *(pMain-1) : 0;
 	BYTE byteval2 = *pAux;
@@ -995,8 +917,8 @@ int UpdateDHiRes160Cell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 	if (xpixel >= 560)	// clip to our 560px display (losing 80 pixels)
 		return 0;
 
-	uint8_t *pAux = MemGetAuxPtr(addr);
-	uint8_t *pMain = MemGetMainPtr(addr);
+	uint8_t *pAux = NTSC_VideoGetAuxPtr(addr);
+	uint8_t *pMain = NTSC_VideoGetMainPtr(addr);
 
 	BYTE byteval1 = (x >  0) ? *(pMain-1) : 0;
 	BYTE byteval2 = *pAux;
@@ -1025,7 +947,7 @@ int UpdateDHiRes160Cell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 // Tested with Deater's Cycle-Counting Megademo
 void UpdateLoResCell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 {
-	const BYTE val = *MemGetMainPtr(addr);
+	const BYTE val = *NTSC_VideoGetMainPtr(addr);
 
 	if ((y & 4) == 0)
 	{
@@ -1044,8 +966,8 @@ void UpdateLoResCell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 // Tested with FT's Ansi Story
 void UpdateDLoResCell (int x, int y, uint16_t addr, bgra_t *pVideoAddress)
 {
-	BYTE auxval = *MemGetAuxPtr(addr);
-	const BYTE mainval = *MemGetMainPtr(addr);
+	BYTE auxval = *NTSC_VideoGetAuxPtr(addr);
+	const BYTE mainval = *NTSC_VideoGetMainPtr(addr);
 
 	const BYTE auxval_h = auxval >> 4;
 	const BYTE auxval_l = auxval & 0xF;
@@ -1073,7 +995,7 @@ void UpdateText40ColorCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress, u
 	uint8_t background = g_nRegularTextBG;
 	if (g_nTextFBMode)
 	{
-		const BYTE val = *MemGetAuxPtr(addr);  // RGB cards with F/B text use their own AUX memory!
+		const BYTE val = *NTSC_VideoGetAuxPtr(addr);  // RGB cards with F/B text use their own AUX memory!
 		foreground = val >> 4;
 		background = val & 0x0F;
 	}
@@ -1104,8 +1026,8 @@ void UpdateText80ColorCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress, u
 // Duochrome HGR (some RGB cards only)
 void UpdateHiResDuochromeCell(int x, int y, uint16_t addr, bgra_t* pVideoAddress)
 {
-	BYTE bits = *MemGetMainPtr(addr);
-	BYTE val = *MemGetAuxPtr(addr);
+	BYTE bits = *NTSC_VideoGetMainPtr(addr);
+	BYTE val = *NTSC_VideoGetAuxPtr(addr);
 	const uint8_t foreground = val >> 4;
 	const uint8_t background = val & 0x0F;
 
@@ -1194,6 +1116,8 @@ void VideoInitializeOriginal(baseColors_t pBaseNtscColors)
 	PaletteRGB_NTSC[HGR_ORANGE] = PaletteRGB_NTSC[ORANGE];
 	PaletteRGB_NTSC[HGR_GREEN]  = PaletteRGB_NTSC[GREEN];
 	PaletteRGB_NTSC[HGR_VIOLET] = PaletteRGB_NTSC[MAGENTA];
+
+	CreateSpanTables();
 }
 
 //===========================================================================
@@ -1206,6 +1130,8 @@ void VideoSwitchVideocardPalette(RGB_Videocard_e videocard, VideoType_e type)
 	{
 		g_pPaletteRGB = PaletteRGB_Feline;
 	}
+
+	CreateSpanTables();
 }
 
 //===========================================================================
@@ -1240,9 +1166,13 @@ void RGB_SetVideoMode(WORD address)
 
 	if (address == 0x5F && g_rgbPrevAN3Addr == 0x5E)
 	{
+		const UINT rgbMode = g_rgbMode;
 		g_rgbFlags = (g_rgbFlags << 1) & 3;
 		g_rgbFlags |= ((GetVideo().GetVideoMode() & VF_80COL) ? 0 : 1);	// clock in !80COL
 		g_rgbMode = g_rgbFlags;								// latch F2,F1
+
+		if (g_rgbMode != rgbMode)
+			NTSC_VideoInvalidateScanlines();	// the same video mode now renders differently
 	}
 
 	g_rgbPrevAN3Addr = address;
@@ -1285,6 +1215,7 @@ void RGB_ResetState(void)
 	g_rgbFlags = 0;
 	g_rgbMode = 0;
 	g_rgbPrevAN3Addr = 0;
+	NTSC_VideoInvalidateScanlines();
 }
 
 void RGB_SetInvertBit7(bool state)
@@ -1327,6 +1258,7 @@ void RGB_LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT cardVersion)
 	g_rgbFlags = yamlLoadHelper.LoadUint(SS_YAML_KEY_RGB_FLAGS);
 	g_rgbMode = yamlLoadHelper.LoadUint(SS_YAML_KEY_RGB_MODE);
 	g_rgbPrevAN3Addr = yamlLoadHelper.LoadUint(SS_YAML_KEY_RGB_PREVIOUS_AN3);
+	NTSC_VideoInvalidateScanlines();
 
 	if (cardVersion >= 3)
 	{
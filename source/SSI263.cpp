@@ -370,6 +370,7 @@ void SSI263::Play(unsigned int nPhoneme)
 	m_phonemeLengthRemaining = g_nPhonemeInfo[nPhoneme].nLength;
 
 	m_phonemeAccurateLengthRemaining = m_phonemeLengthRemaining;
+	CpuUpdateDue();	// the phoneme is timed by Update() (see GetCyclesUntilUpdate())
 	m_phonemePlaybackAndDebugger = (g_nAppMode == MODE_STEPPING || g_nAppMode == MODE_DEBUG);
 	m_phonemeCompleteByFullSpeed = false;
 	m_phonemeLeadoutLength = m_phonemeLengthRemaining / 10;	// Arbitrary! (TODO: determine a more accurate factor)
@@ -931,9 +932,10 @@ void SSI263::SetVolume(DWORD dwVolume, DWORD dwVolumeMax)
 
 //-----------------------------------------------------------------------------
 
+static const UINT kCyclesPerAudioFrame = 1000;
+
 void SSI263::PeriodicUpdate(UINT executedCycles)
 {
-	const UINT kCyclesPerAudioFrame = 1000;
 	m_cyclesThisAudioFrame += executedCycles;
 	if (m_cyclesThisAudioFrame < kCyclesPerAudioFrame)
 		return;
@@ -943,6 +945,15 @@ void SSI263::PeriodicUpdate(UINT executedCycles)
 	Update();
 }
 
+// Update() has nothing to do unless a phoneme is being timed or the ring-buffer is playing
+UINT SSI263::GetCyclesUntilUpdate(void)
+{
+	if (!m_phonemeAccurateLengthRemaining && !SSI263SingleVoice.bActive)
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	return kCyclesPerAudioFrame - m_cyclesThisAudioFrame;
+}
+
 //=============================================================================
 
 #define SS_YAML_KEY_SSI263 "SSI263"
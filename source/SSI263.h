@@ -90,6 +90,7 @@ public:
 	void SetVolume(DWORD dwVolume, DWORD dwVolumeMax);
 
 	void PeriodicUpdate(UINT executedCycles);
+	UINT GetCyclesUntilUpdate(void);
 	void Update(void);
 	void SetSpeechIRQ(void);
 
@@ -281,7 +281,14 @@ static void ParseUnitApple2(YamlLoadHelper& yamlLoadHelper, UINT version)
 
 //---
 
-static void ParseSlots(YamlLoadHelper& yamlLoadHelper, UINT unitVersion)
+// A disk controller card that's already in the slot is kept, so that it can keep any disk image that's still inserted
+// . rather than re-open & re-read the image (eg. libretro's rewind & run-ahead load a save-state every frame)
+static bool IsCardKeptForSnapshot(const SS_CARDTYPE type)
+{
+	return type == CT_Disk2 || type == CT_GenericHDD;
+}
+
+static void ParseSlots(YamlLoadHelper& yamlLoadHelper, UINT unitVersion, bool (&slotLoaded)[NUM_SLOTS])
 {
 	if (unitVersion != UNIT_SLOTS_VER)
 		throw std::runtime_error(SS_YAML_KEY_UNIT ": Slots: Version mismatch");
@@ -312,11 +319,13 @@ static void ParseSlots(YamlLoadHelper& yamlLoadHelper, UINT unitVersion)
 		{
 			SetExpansionMemType(type);	// calls GetCardMgr().Insert() & InsertAux()
 		}
-		else
+		else if (!IsCardKeptForSnapshot(type) || GetCardMgr().QuerySlot(slot) != type)
 		{
 			GetCardMgr().Insert(slot, type);
 		}
 
+		slotLoaded[slot] = true;
+
 		bRes = GetCardMgr().GetRef(slot).LoadSnapshot(yamlLoadHelper, cardVersion);
 
 		yamlLoadHelper.PopMap();
@@ -327,7 +336,7 @@ static void ParseSlots(YamlLoadHelper& yamlLoadHelper, UINT unitVersion)
 
 //---
 
-static void ParseUnit(void)
+static void ParseUnit(bool (&slotLoaded)[NUM_SLOTS])
 {
 	yamlHelper.GetMapStartEvent();
 
@@ -352,7 +361,7 @@ static void ParseUnit(void)
 	}
 	else if (unit == GetSnapshotUnitSlotsName())
 	{
-		ParseSlots(yamlLoadHelper, unitVersion);
+		ParseSlots(yamlLoadHelper, unitVersion, slotLoaded);
 	}
 	else if (unit == GetSnapshotUnitGameIOConnectorName())
 	{
@@ -369,17 +378,26 @@ static void ParseUnit(void)
 	}
 }
 
-static void Snapshot_LoadState_v2(void)
+// pData: binary save-state, or NULL to load the YAML save-state file g_strSaveStatePathname
+static bool Snapshot_LoadState_v2(const BYTE* pData = NULL, const size_t size = 0)
 {
 	bool restart = false;	// Only need to restart if any VM state has change
+	bool loaded = false;
 	HCURSOR oldcursor = SetCursor(LoadCursor(0,IDC_WAIT));
 
 	FrameBase& frame = GetFrame();
 
 	try
 	{
-		if (!yamlHelper.InitParser(g_strSaveStatePathname.c_str()))
+		if (pData)
+		{
+			if (!yamlHelper.InitParser(pData, size))
+				throw std::runtime_error("Failed to initialize parser: not a binary save-state");
+		}
+		else if (!yamlHelper.InitParser(g_strSaveStatePathname.c_str()))
+		{
 			throw std::runtime_error("Failed to initialize parser or open file: " + g_strSaveStatePathname);
+		}
 
 		if (yamlHelper.ParseFileHdr(SS_YAML_VALUE_AWSS) != SS_FILE_VER)
 			throw std::runtime_error("Version mismatch");
@@ -390,8 +408,12 @@ static void Snapshot_LoadState_v2(void)
 
 		//m_ConfigNew.m_bEnableTheFreezesF8Rom = ?;	// todo: when support saving config
 
+		bool slotLoaded[NUM_SLOTS] = {};
 		for (UINT slot = SLOT0; slot < NUM_SLOTS; slot++)
-			GetCardMgr().Remove(slot);
+		{
+			if (!IsCardKeptForSnapshot(GetCardMgr().QuerySlot(slot)))
+				GetCardMgr().Remove(slot);
+		}
 		GetCardMgr().RemoveAux();
 
 		SetCopyProtectionDongleType(DT_EMPTY);
@@ -412,11 +434,17 @@ static void Snapshot_LoadState_v2(void)
 		while(yamlHelper.GetScalar(scalar))
 		{
 			if (scalar == SS_YAML_KEY_UNIT)
-				ParseUnit();
+				ParseUnit(slotLoaded);
 			else
 				throw std::runtime_error("Unknown top-level scalar: " + scalar);
 		}
 
+		for (UINT slot = SLOT0; slot < NUM_SLOTS; slot++)
+		{
+			if (!slotLoaded[slot] && IsCardKeptForSnapshot(GetCardMgr().QuerySlot(slot)))
+				GetCardMgr().Remove(slot);	// a kept card that's not in the save-state
+		}
+
 		GetCardMgr().GetMockingboardCardMgr().SetCumulativeCycles();
 		frame.SetLoadedSaveStateFlag(true);
 
@@ -439,6 +467,7 @@ static void Snapshot_LoadState_v2(void)
 
 		// g_Apple2Type may've changed: so reload button bitmaps & redraw frame (title, buttons, leds, etc)
 		frame.FrameUpdateApple2Type();	// NB. Calls VideoRedrawScreen()
+		loaded = true;
 	}
 	catch(const std::exception & szMessage)
 	{
@@ -453,9 +482,10 @@ static void Snapshot_LoadState_v2(void)
 
 	SetCursor(oldcursor);
 	yamlHelper.FinaliseParser();
+	return loaded;
 }
 
-void Snapshot_LoadState()
+bool Snapshot_LoadState()
 {
 	const std::string ext_aws = (".aws");
 	const size_t pos = g_strSaveStatePathname.size() - ext_aws.size();
@@ -467,65 +497,75 @@ void Snapshot_LoadState()
 					TEXT("Load State"),
 					MB_ICONEXCLAMATION | MB_SETFOREGROUND);
 
-		return;
+		return false;
 	}
 
 	LogFileOutput("Loading Save-State from %s\n", g_strSaveStatePathname.c_str());
-	Snapshot_LoadState_v2();
+	return Snapshot_LoadState_v2();
+}
+
+bool Snapshot_LoadStateFromMemory(const BYTE* pData, const size_t size)
+{
+	return Snapshot_LoadState_v2(pData, size);
 }
 
 //-----------------------------------------------------------------------------
 
-void Snapshot_SaveState(void)
+static void SaveState(YamlSaveHelper& yamlSaveHelper)
 {
-	LogFileOutput("Saving Save-State to %s\n", g_strSaveStatePathname.c_str());
-	try
+	yamlSaveHelper.FileHdr(SS_FILE_VER);
+
+	// Unit: Apple2
 	{
-		YamlSaveHelper yamlSaveHelper(g_strSaveStatePathname);
-		yamlSaveHelper.FileHdr(SS_FILE_VER);
+		yamlSaveHelper.UnitHdr(GetSnapshotUnitApple2Name(), UNIT_APPLE2_VER);
+		YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
+
+		yamlSaveHelper.Save("%s: %s\n", SS_YAML_KEY_MODEL, GetApple2TypeAsString().c_str());
+		CpuSaveSnapshot(yamlSaveHelper);
+		JoySaveSnapshot(yamlSaveHelper);
+		KeybSaveSnapshot(yamlSaveHelper);
+		SpkrSaveSnapshot(yamlSaveHelper);
+		GetVideo().VideoSaveSnapshot(yamlSaveHelper);
+		MemSaveSnapshot(yamlSaveHelper);
+	}
 
-		// Unit: Apple2
-		{
-			yamlSaveHelper.UnitHdr(GetSnapshotUnitApple2Name(), UNIT_APPLE2_VER);
-			YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
-
-			yamlSaveHelper.Save("%s: %s\n", SS_YAML_KEY_MODEL, GetApple2TypeAsString().c_str());
-			CpuSaveSnapshot(yamlSaveHelper);
-			JoySaveSnapshot(yamlSaveHelper);
-			KeybSaveSnapshot(yamlSaveHelper);
-			SpkrSaveSnapshot(yamlSaveHelper);
-			GetVideo().VideoSaveSnapshot(yamlSaveHelper);
-			MemSaveSnapshot(yamlSaveHelper);
-		}
+	// Unit: Aux slot
+	MemSaveSnapshotAux(yamlSaveHelper);
 
-		// Unit: Aux slot
-		MemSaveSnapshotAux(yamlSaveHelper);
+	// Unit: Slots
+	{
+		yamlSaveHelper.UnitHdr(GetSnapshotUnitSlotsName(), UNIT_SLOTS_VER);
+		YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
 
-		// Unit: Slots
-		{
-			yamlSaveHelper.UnitHdr(GetSnapshotUnitSlotsName(), UNIT_SLOTS_VER);
-			YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
+		GetCardMgr().SaveSnapshot(yamlSaveHelper);
+	}
 
-			GetCardMgr().SaveSnapshot(yamlSaveHelper);
-		}
+	// Unit: Game I/O Connector
+	if (GetCopyProtectionDongleType() != DT_EMPTY)
+	{
+		yamlSaveHelper.UnitHdr(GetSnapshotUnitGameIOConnectorName(), UNIT_GAME_IO_CONNECTOR_VER);
+		YamlSaveHelper::Label unit(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
 
-		// Unit: Game I/O Connector
-		if (GetCopyProtectionDongleType() != DT_EMPTY)
-		{
-			yamlSaveHelper.UnitHdr(GetSnapshotUnitGameIOConnectorName(), UNIT_GAME_IO_CONNECTOR_VER);
-			YamlSaveHelper::Label unit(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
+		CopyProtectionDongleSaveSnapshot(yamlSaveHelper);
+	}
 
-			CopyProtectionDongleSaveSnapshot(yamlSaveHelper);
-		}
+	// Miscellaneous
+	if (MemHasNoSlotClock())
+	{
+		yamlSaveHelper.UnitHdr(GetSnapshotUnitMiscName(), UNIT_MISC_VER);
+		YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
 
-		// Miscellaneous
-		if (MemHasNoSlotClock())
-		{
-			yamlSaveHelper.UnitHdr(GetSnapshotUnitMiscName(), UNIT_MISC_VER);
-			YamlSaveHelper::Label state(yamlSaveHelper, "%s:\n", SS_YAML_KEY_STATE);
+		NoSlotClockSaveSnapshot(yamlSaveHelper);
+	}
+}
 
-			NoSlotClockSaveSnapshot(yamlSaveHelper);
-		}
+void Snapshot_SaveState(void)
+{
+	LogFileOutput("Saving Save-State to %s\n", g_strSaveStatePathname.c_str());
+	try
+	{
+		YamlSaveHelper yamlSaveHelper(g_strSaveStatePathname);
+		SaveState(yamlSaveHelper);
 	}
 	catch(const std::exception & szMessage)
 	{
@@ -536,6 +576,25 @@ void Snapshot_SaveState(void)
 	}
 }
 
+// Binary save-state: same content as Snapshot_SaveState(), but no file I/O or YAML formatting
+// . Returns the save-state's size: if this is bigger than 'size' then the buffer was too small (and its content is incomplete)
+// . pBuffer can be NULL to just get the size
+// . Returns 0 on error
+size_t Snapshot_SaveStateToMemory(BYTE* pBuffer, const size_t size)
+{
+	try
+	{
+		YamlSaveHelper yamlSaveHelper(pBuffer, size);
+		SaveState(yamlSaveHelper);
+		return yamlSaveHelper.FinaliseBinary();
+	}
+	catch(const std::exception & szMessage)
+	{
+		LogFileOutput("Save State: %s\n", szMessage.what());
+		return 0;
+	}
+}
+
 //-----------------------------------------------------------------------------
 
 void Snapshot_Startup()
@@ -8,8 +8,10 @@ const std::string& Snapshot_GetPath(void);
 const std::string& Snapshot_GetPathname(void);
 void Snapshot_GetDefaultFilenameAndPath(std::string& defaultFilename, std::string& defaultPath);
 void Snapshot_UpdatePath(void);
-void Snapshot_LoadState();
+bool Snapshot_LoadState();
 void Snapshot_SaveState();
+bool Snapshot_LoadStateFromMemory(const BYTE* pData, const size_t size);
+size_t Snapshot_SaveStateToMemory(BYTE* pBuffer, const size_t size);
 void Snapshot_Startup();
 void Snapshot_Shutdown();
 
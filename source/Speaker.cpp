@@ -29,6 +29,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include "StdAfx.h"
 
 #include "Speaker.h"
+#include "Card.h"
 #include "Core.h"
 #include "CPU.h"
 #include "Interface.h"
@@ -506,6 +507,16 @@ void SpkrUpdate_Timer()
 	}
 }
 
+// Cycles the CPU can execute before SpkrUpdate() is due
+// . Without a playing voice, SpkrUpdate() just discards the samples (and the buffer is capped at 1 sec)
+ULONG SpkrGetCyclesUntilUpdate(void)
+{
+	if (soundtype != SOUND_WAVE || !SpeakerVoice.bActive)
+		return CYCLES_UNTIL_UPDATE_NONE;
+
+	return (ULONG)(g_fCurrentCLK6502 / 1000.0);	// keep the play-buffer topped-up
+}
+
 //=============================================================================
 
 static DWORD dwByteOffset = (DWORD)-1;
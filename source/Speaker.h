@@ -24,6 +24,7 @@ void    SpkrReset();
 void    SpkrSetEmulationType (SoundType_e newSoundType);
 void    SpkrUpdate (DWORD);
 void    SpkrUpdate_Timer();
+ULONG   SpkrGetCyclesUntilUpdate(void);
 DWORD   SpkrGetVolume();
 void    SpkrSetVolume(DWORD dwVolume, DWORD dwVolumeMax);
 void    Spkr_Mute();
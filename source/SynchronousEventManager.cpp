@@ -23,18 +23,22 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 
 /* Description: Synchronous Event Manager
  *
- * This manager class maintains a linked-list of ordered timer-based event,
- * where only the head of the list needs updating after every opcode.
+ * This manager class maintains a priority queue of timer-based events, keyed by the absolute
+ * cycle at which each event expires. The cycle of the next event to expire is cached, so after
+ * every opcode Update() only needs to advance the cycle count and compare it against this.
  *
- * The Nth event in the list will expire in: event[1] + ... + event[N] cycles time.
- * (So each event has a cycle delta expiry time relative to the previous event.)
+ * The queue is a 4-ary min-heap: it is shallow for the handful of events that are typically
+ * active (eg. 2 Mockingboards = 8 timers, plus mousecard VBlank & disk stepper), and insert/remove
+ * are O(log n) instead of walking a list.
  *
  * A synchronous event is used for a deterministic event that will occur in N cycles' time,
  * eg. 6522 timer & Mousecard VBlank. (As opposed to async events, like SSC Rx/Tx interrupts.)
  *
- * Events that are active in the list can be removed before they expire,
+ * Events that are active in the queue can be removed before they expire,
  * eg. 6522 timer when the interval changes.
  *
+ * Events that expire at the same cycle are fired in the order they were inserted.
+ *
  * Author: Various
  *
  */
@@ -44,123 +48,167 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include "SynchronousEventManager.h"
 #include "CPU.h"
 
+int SynchronousEventManager::GetCyclesRemaining(const SyncEvent* pEvent) const
+{
+	_ASSERT(pEvent->m_active);
+	return (int)(pEvent->m_cycleExpiry - m_cycles);
+}
+
 void SynchronousEventManager::Insert(SyncEvent* pNewEvent)
 {
+	_ASSERT(!pNewEvent->m_active);
 	pNewEvent->m_active = true;	// add always succeeds
 
-	if (!m_syncEventHead)
+	pNewEvent->m_cycleExpiry = m_cycles + pNewEvent->m_cyclesRemaining;
+	Push(pNewEvent);
+}
+
+bool SynchronousEventManager::Remove(int id)
+{
+	for (size_t i = 0; i < m_heap.size(); i++)
 	{
-		m_syncEventHead = pNewEvent;
-		return;
+		if (m_heap[i]->m_id != id)
+			continue;
+
+		SyncEvent* pEvent = m_heap[i];
+		RemoveAt(i);
+
+		pEvent->m_cyclesRemaining = (int)(pEvent->m_cycleExpiry - m_cycles);
+		pEvent->m_active = false;
+		return true;
 	}
 
-	// walk list to find where to insert new event
+	// Not pending: eg. a callback removing its own event (which has already been unlinked by ProcessEvents())
+	return false;
+}
 
-	SyncEvent* pPrevEvent = NULL;
-	SyncEvent* pCurrEvent = m_syncEventHead;
-	int newEventExtraCycles = pNewEvent->m_cyclesRemaining;
+void SynchronousEventManager::Reset(void)
+{
+	for (size_t i = 0; i < m_heap.size(); i++)
+		m_heap[i]->m_active = false;
 
-	while (pCurrEvent)
-	{
-		if (newEventExtraCycles >= pCurrEvent->m_cyclesRemaining)
-		{
-			newEventExtraCycles -= pCurrEvent->m_cyclesRemaining;
+	m_heap.clear();
+	m_cycles = 0;
+	m_nextEventCycle = kNoEvent;
+}
 
-			pPrevEvent = pCurrEvent;
-			pCurrEvent = pCurrEvent->m_next;
+// Fire all events that have expired by the end of the current opcode.
+// . 'cycles' passed to the 1st callback is the opcode's cycles; for subsequent callbacks it's
+//   the number of cycles the previous event underflowed by (same as the old delta-list manager).
+// . Events are only re-added once all expired events have fired, last-fired first.
+void SynchronousEventManager::ProcessEvents(int cycles, ULONG uExecutedCycles)
+{
+	m_expired.clear();
 
-			if (!pCurrEvent)	// end of list
-			{
-				pPrevEvent->m_next = pNewEvent;
-				pNewEvent->m_cyclesRemaining = newEventExtraCycles;
-			}
+	while (!m_heap.empty() && m_heap[0]->m_cycleExpiry <= m_cycles)
+	{
+		SyncEvent* pEvent = m_heap[0];
 
-			continue;
-		}
+		if (pEvent->m_cycleExpiry == m_cycles && pEvent->m_canAssertIRQ)
+			SetIrqOnLastOpcodeCycle();		// IRQ occurs on last cycle of opcode
 
-		// insert new event
-		if (!pPrevEvent)
-			m_syncEventHead = pNewEvent;
-		else
-			pPrevEvent->m_next = pNewEvent;
-		pNewEvent->m_next = pCurrEvent;
+		const int cyclesUnderflowed = (int)(m_cycles - pEvent->m_cycleExpiry);
 
-		pNewEvent->m_cyclesRemaining = newEventExtraCycles;
+		RemoveAt(0);	// unlink this event (but it remains active until the callback returns)
+		pEvent->m_cyclesRemaining = pEvent->m_callback(pEvent->m_id, cycles, uExecutedCycles);
+		pEvent->m_active = false;
 
-		// update cycles for next event
-		if (pCurrEvent)
-		{
-			pCurrEvent->m_cyclesRemaining -= newEventExtraCycles;
-			_ASSERT(pCurrEvent->m_cyclesRemaining >= 0);
-		}
+		m_expired.push_back(pEvent);
+		cycles = cyclesUnderflowed;
+	}
 
-		return;
+	for (size_t i = m_expired.size(); i > 0; i--)
+	{
+		SyncEvent* pEvent = m_expired[i - 1];
+		if (pEvent->m_cyclesRemaining && !pEvent->m_active)
+			Insert(pEvent);	// re-add event
 	}
 }
 
-bool SynchronousEventManager::Remove(int id)
+//
+
+void SynchronousEventManager::Push(SyncEvent* pEvent)
 {
-	SyncEvent* pPrevEvent = NULL;
-	SyncEvent* pCurrEvent = m_syncEventHead;
+	pEvent->m_sequence = m_sequence++;
+	m_heap.push_back(pEvent);
+	pEvent->m_heapIndex = m_heap.size() - 1;
+	SiftUp(pEvent->m_heapIndex);
+	m_nextEventCycle = m_heap[0]->m_cycleExpiry;
+}
 
-	while (pCurrEvent)
+void SynchronousEventManager::RemoveAt(size_t index)
+{
+	SyncEvent* pLast = m_heap.back();
+	m_heap.pop_back();
+
+	if (index < m_heap.size())
 	{
-		if (pCurrEvent->m_id != id)
-		{
-			pPrevEvent = pCurrEvent;
-			pCurrEvent = pCurrEvent->m_next;
-			continue;
-		}
+		Place(index, pLast);
+		SiftUp(index);
+		SiftDown(pLast->m_heapIndex);
+	}
 
-		// remove event
-		if (!pPrevEvent)
-			m_syncEventHead = pCurrEvent->m_next;
-		else
-			pPrevEvent->m_next = pCurrEvent->m_next;
+	if (m_heap.empty())
+		m_nextEventCycle = kNoEvent;
+	else
+		m_nextEventCycle = m_heap[0]->m_cycleExpiry;
+}
 
-		int oldEventExtraCycles = pCurrEvent->m_cyclesRemaining;
-		pPrevEvent = pCurrEvent;
-		pCurrEvent = pCurrEvent->m_next;
+bool SynchronousEventManager::IsEarlier(const SyncEvent* a, const SyncEvent* b)
+{
+	return a->m_cycleExpiry < b->m_cycleExpiry || (a->m_cycleExpiry == b->m_cycleExpiry && a->m_sequence < b->m_sequence);
+}
 
-		pPrevEvent->m_active = false;
-		pPrevEvent->m_next = NULL;
+void SynchronousEventManager::SiftUp(size_t index)
+{
+	SyncEvent* pEvent = m_heap[index];
 
-		// update cycles for next event
-		if (pCurrEvent)
-			pCurrEvent->m_cyclesRemaining += oldEventExtraCycles;
+	while (index > 0)
+	{
+		const size_t parent = (index - 1) / kHeapArity;
+		SyncEvent* pParent = m_heap[parent];
+		if (!IsEarlier(pEvent, pParent))
+			break;
 
-		return true;
+		Place(index, pParent);
+		index = parent;
 	}
 
-	_ASSERT(0);
-	return false;
+	Place(index, pEvent);
 }
 
-void SynchronousEventManager::Update(int cycles, ULONG uExecutedCycles)
+void SynchronousEventManager::SiftDown(size_t index)
 {
-	SyncEvent* pCurrEvent = m_syncEventHead;
-
-	if (!pCurrEvent)
-		return;
+	SyncEvent* pEvent = m_heap[index];
+	const size_t size = m_heap.size();
 
-	pCurrEvent->m_cyclesRemaining -= cycles;
-	if (pCurrEvent->m_cyclesRemaining <= 0)
+	while (true)
 	{
-		if (pCurrEvent->m_cyclesRemaining == 0 && pCurrEvent->m_canAssertIRQ)
-			SetIrqOnLastOpcodeCycle();		// IRQ occurs on last cycle of opcode
+		const size_t firstChild = index * kHeapArity + 1;
+		if (firstChild >= size)
+			break;
 
-		int cyclesUnderflowed = -pCurrEvent->m_cyclesRemaining;
+		size_t earliest = firstChild;
+		const size_t lastChild = firstChild + kHeapArity < size ? firstChild + kHeapArity : size;
+		for (size_t child = firstChild + 1; child < lastChild; child++)
+		{
+			if (IsEarlier(m_heap[child], m_heap[earliest]))
+				earliest = child;
+		}
 
-		pCurrEvent->m_cyclesRemaining = pCurrEvent->m_callback(pCurrEvent->m_id, cycles, uExecutedCycles);
-		m_syncEventHead = pCurrEvent->m_next;	// unlink this event
+		SyncEvent* pChild = m_heap[earliest];
+		if (!IsEarlier(pChild, pEvent))
+			break;
 
-		pCurrEvent->m_active = false;
-		pCurrEvent->m_next = NULL;
+		Place(index, pChild);
+		index = earliest;
+	}
 
-		// Always Update even if cyclesUnderflowed=0, as next event may have cycleRemaining=0 (ie. the 2 events fire at the same time)
-		Update(cyclesUnderflowed, uExecutedCycles);	// update (potential) next event with underflow cycles
+	Place(index, pEvent);
+}
 
-		if (pCurrEvent->m_cyclesRemaining)
-			Insert(pCurrEvent);	// re-add event
-	}
+void SynchronousEventManager::Place(size_t index, SyncEvent* pEvent)
+{
+	m_heap[index] = pEvent;
+	pEvent->m_heapIndex = index;
 }
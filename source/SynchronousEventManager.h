@@ -1,24 +1,48 @@
 #pragma once
 
+#include <vector>
+
 class SyncEvent;
 
 class SynchronousEventManager
 {
 public:
-	SynchronousEventManager() : m_syncEventHead(NULL)
+	SynchronousEventManager() : m_cycles(0), m_nextEventCycle(kNoEvent), m_sequence(0)
 	{}
 	~SynchronousEventManager(){}
 
-	SyncEvent* GetHead(void) { return m_syncEventHead; }
-	void SetHead(SyncEvent* head) { m_syncEventHead = head; }
+	SyncEvent* GetHead(void) { return m_heap.empty() ? NULL : m_heap[0]; }
+	int GetCyclesRemaining(const SyncEvent* pEvent) const;
 
 	void Insert(SyncEvent* pNewEvent);
 	bool Remove(int id);
-	void Update(int cycles, ULONG uExecutedCycles);
-	void Reset(void) { m_syncEventHead = NULL; }
+	void Reset(void);
+
+	// Called after every opcode: only the next event's expiry cycle needs checking
+	void Update(int cycles, ULONG uExecutedCycles)
+	{
+		m_cycles += cycles;
+		if (m_cycles >= m_nextEventCycle)
+			ProcessEvents(cycles, uExecutedCycles);
+	}
 
 private:
-	SyncEvent* m_syncEventHead;
+	static const UINT64 kNoEvent = ~(UINT64)0;
+	static const size_t kHeapArity = 4;
+
+	void ProcessEvents(int cycles, ULONG uExecutedCycles);
+	void Push(SyncEvent* pEvent);
+	void RemoveAt(size_t index);
+	void SiftUp(size_t index);
+	void SiftDown(size_t index);
+	void Place(size_t index, SyncEvent* pEvent);
+	static bool IsEarlier(const SyncEvent* a, const SyncEvent* b);
+
+	UINT64 m_cycles;			// cycles executed since construction or Reset()
+	UINT64 m_nextEventCycle;	// cached expiry cycle of m_heap[0] (or kNoEvent)
+	UINT64 m_sequence;			// insertion order: events with the same expiry cycle fire first-in, first-out
+	std::vector<SyncEvent*> m_heap;		// 4-ary min-heap, ordered by expiry cycle then insertion order
+	std::vector<SyncEvent*> m_expired;	// scratch for ProcessEvents()
 };
 
 //
@@ -34,7 +58,9 @@ public:
 		m_active(false),
 		m_canAssertIRQ(true),
 		m_callback(callback),
-		m_next(NULL)
+		m_cycleExpiry(0),
+		m_sequence(0),
+		m_heapIndex(0)
 	{}
 	~SyncEvent(){}
 
@@ -44,9 +70,15 @@ public:
 	}
 
 	int m_id;
-	int m_cyclesRemaining;
+	int m_cyclesRemaining;	// cycles until expiry, relative to when Insert() is called
 	bool m_active;
 	bool m_canAssertIRQ;
 	syncEventCB m_callback;
-	SyncEvent* m_next;
+
+private:
+	friend class SynchronousEventManager;
+
+	UINT64 m_cycleExpiry;	// absolute SynchronousEventManager cycle
+	UINT64 m_sequence;
+	size_t m_heapIndex;
 };
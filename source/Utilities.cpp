@@ -310,6 +310,10 @@ void LoadConfiguration(bool loadImages)
 	REGLOAD_DEFAULT(TEXT(REGVALUE_ENHANCE_DISK_SPEED), &dwEnhanceDisk, 1);
 	GetCardMgr().GetDisk2CardMgr().SetEnhanceDisk(dwEnhanceDisk ? true : false);
 
+	DWORD dwFastDisk;
+	REGLOAD_DEFAULT(TEXT(REGVALUE_FAST_DISK), &dwFastDisk, 0);
+	GetCardMgr().GetDisk2CardMgr().SetFastDisk(dwFastDisk ? true : false);
+
 	//
 
 	if (GetCardMgr().IsParallelPrinterCardInstalled())
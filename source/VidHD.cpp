@@ -232,7 +232,7 @@ bool VidHDCard::LoadSnapshot(YamlLoadHelper& yamlLoadHelper, UINT version)
 		if (!yamlLoadHelper.GetSubMap(MemGetSnapshotAuxMemStructName()))
 			throw std::runtime_error("Memory: Missing map name: " + MemGetSnapshotAuxMemStructName());
 
-		LPBYTE pMemBase = MemGetBankPtr(1, false);
+		LPBYTE pMemBase = MemGetBankPtr(1);
 		yamlLoadHelper.LoadMemory(pMemBase, (SHR_MEMORY_END + 1) - TEXT_PAGE1_BEGIN, TEXT_PAGE1_BEGIN);
 
 		yamlLoadHelper.PopMap();
@@ -176,6 +176,8 @@ void Video::VideoResetState(void)
 
 BYTE Video::VideoSetMode(WORD pc, WORD address, BYTE write, BYTE d, ULONG uExecutedCycles)
 {
+	NTSCRenderLock lock;	// also covers the RGB card's state
+
 	const uint32_t oldVideoMode = g_uVideoMode;
 
 	VidHDCard* vidHD = NULL;
@@ -269,6 +271,120 @@ bool Video::VideoGetSWAltCharSet(void)
 
 //===========================================================================
 
+// FNV-1a
+static uint64_t ScreenHashBytes(uint64_t hash, const BYTE* pData, UINT uLen)
+{
+	for (UINT i = 0; i < uLen; i++)
+	{
+		hash ^= pData[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// Only the 40 visible bytes of each row: the screen holes are not part of the screen
+static uint64_t ScreenHashTextRows(uint64_t hash, WORD base, UINT firstRow, UINT lastRow, bool bAux)
+{
+	for (UINT row = firstRow; row < lastRow; row++)
+	{
+		const WORD addr = base + (row & 7) * 0x80 + (row >> 3) * 0x28;
+		if (bAux)
+			hash = ScreenHashBytes(hash, MemGetAuxPtr(addr), 40);
+		hash = ScreenHashBytes(hash, MemGetMainPtr(addr), 40);
+	}
+	return hash;
+}
+
+static uint64_t ScreenHashHiresLines(uint64_t hash, WORD base, UINT lastLine, bool bAux)
+{
+	for (UINT line = 0; line < lastLine; line++)
+	{
+		const WORD addr = base + (line & 7) * 0x400 + ((line >> 3) & 7) * 0x80 + (line >> 6) * 0x28;
+		if (bAux)
+			hash = ScreenHashBytes(hash, MemGetAuxPtr(addr), 40);
+		hash = ScreenHashBytes(hash, MemGetMainPtr(addr), 40);
+	}
+	return hash;
+}
+
+uint64_t Video::GetScreenHash(void)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	if (SW_SHR)
+	{
+		// VidHD: pixels, SCBs & palettes
+		const uint32_t mode = VF_SHR;
+		hash = ScreenHashBytes(hash, (const BYTE*)&mode, sizeof(mode));
+		return ScreenHashBytes(hash, MemGetAuxPtr(0x2000), 0x8000);
+	}
+
+	// Only the switches which change what is displayed: eg. 80STORE just selects page 1
+	const bool bText = SW_TEXT ? true : false;
+	const bool bMixed = !bText && SW_MIXED;
+	const bool bHires = !bText && SW_HIRES;
+	const bool bDouble = !bText && SW_DHIRES && SW_80COL;
+	const bool b80Col = (bText || bMixed) && SW_80COL;
+	const bool bPage2 = SW_PAGE2 && !SW_80STORE;
+	const bool bAltCharSet = (bText || bMixed) && g_nAltCharSetOffset;
+
+	const uint32_t mode = (bText ? VF_TEXT : 0) | (bMixed ? VF_MIXED : 0) | (bHires ? VF_HIRES : 0)
+		| (bDouble ? VF_DHIRES : 0) | (b80Col ? VF_80COL : 0) | (bPage2 ? VF_PAGE2 : 0) | (bAltCharSet ? 0x80000000 : 0);
+	hash = ScreenHashBytes(hash, (const BYTE*)&mode, sizeof(mode));
+
+	const WORD textBase = bPage2 ? 0x0800 : 0x0400;
+	const UINT graphicsRows = bText ? 0 : bMixed ? 20 : 24;
+
+	if (bHires)
+		hash = ScreenHashHiresLines(hash, bPage2 ? 0x4000 : 0x2000, graphicsRows * 8, bDouble);
+	else
+		hash = ScreenHashTextRows(hash, textBase, 0, graphicsRows, bDouble);	// lores
+
+	return ScreenHashTextRows(hash, textBase, graphicsRows, 24, b80Col);
+}
+
+uint64_t Video::GetFrameBufferPerceptualHash(void)
+{
+	const UINT kGrid = 8;
+	const UINT width = GetFrameBufferBorderlessWidth();
+	const UINT height = GetFrameBufferBorderlessHeight();
+	const bgra_t* pSrc = (const bgra_t*)g_pFramebufferbits + GetFrameBufferBorderHeight() * GetFrameBufferWidth() + GetFrameBufferBorderWidth();
+
+	// Total luma of each block of an 8x8 grid
+	uint32_t aBlock[kGrid * kGrid] = {0};
+	for (UINT y = 0; y < height; y++)
+	{
+		const bgra_t* pRow = pSrc + y * GetFrameBufferWidth();
+		uint32_t* pBlock = aBlock + (y * kGrid / height) * kGrid;
+		for (UINT x = 0; x < width; x++)
+			pBlock[x * kGrid / width] += (pRow[x].r * 77 + pRow[x].g * 150 + pRow[x].b * 29) >> 8;
+	}
+
+	uint64_t total = 0;
+	for (UINT i = 0; i < kGrid * kGrid; i++)
+		total += aBlock[i];
+	const uint64_t mean = total / (kGrid * kGrid);
+
+	// 1 bit per block: brighter than the average block
+	uint64_t hash = 0;
+	for (UINT i = 0; i < kGrid * kGrid; i++)
+	{
+		if (aBlock[i] > mean)
+			hash |= 1ULL << i;
+	}
+	return hash;
+}
+
+UINT Video::GetScreenHashDistance(uint64_t hash1, uint64_t hash2)
+{
+	UINT uDistance = 0;
+	for (uint64_t bits = hash1 ^ hash2; bits; bits &= bits - 1)
+		uDistance++;
+	return uDistance;
+}
+
+//===========================================================================
+
 #define SS_YAML_KEY_ALT_CHARSET "Alt Char Set"
 #define SS_YAML_KEY_VIDEO_MODE "Video Mode"
 #define SS_YAML_KEY_CYCLES_THIS_FRAME "Cycles This Frame"
@@ -448,6 +564,8 @@ WORD Video::VideoGetScannerAddress(DWORD nCycles, VideoScanner_e videoScannerAdd
 // Called when *outside* of CpuExecute()
 bool Video::VideoGetVblBarEx(const DWORD dwCyclesThisFrame)
 {
+	NTSCRenderLock lock;	// for the resync & the read together
+
 	if (g_bFullSpeed)
 	{
 		// Ensure that NTSC video-scanner gets updated during full-speed, so video screen can be redrawn during Apple II VBL
@@ -460,6 +578,8 @@ bool Video::VideoGetVblBarEx(const DWORD dwCyclesThisFrame)
 // Called when *inside* CpuExecute()
 bool Video::VideoGetVblBar(const DWORD uExecutedCycles)
 {
+	NTSCRenderLock lock;	// for the resync & the read together
+
 	if (g_bFullSpeed)
 	{
 		// Ensure that NTSC video-scanner gets updated during full-speed, so video-dependent Apple II code doesn't hang
@@ -849,6 +969,7 @@ void Video::ClearFrameBuffer(void)
 {
 	UINT32* frameBuffer = (UINT32*)GetFrameBuffer();
 	std::fill(frameBuffer, frameBuffer + GetFrameBufferWidth() * GetFrameBufferHeight(), OPAQUE_BLACK);
+	NTSC_VideoInvalidateScanlines();
 }
 
 // Called when entering debugger, and after viewing Apple II video screen from debugger
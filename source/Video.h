@@ -235,6 +235,14 @@ public:
 	bool VideoGetSWTEXT(void);
 	bool VideoGetSWAltCharSet(void);
 
+	// Hash of the displayed Apple II screen, from the video memory and the soft switches:
+	// independent of the video type & style and needs no rendering (eg. with NTSC updates disabled)
+	uint64_t GetScreenHash(void);
+	// Hash of the rendered frame buffer which tolerates small differences (eg. rendering style, cursor):
+	// the screen is split in 8x8 blocks, 1 bit per block set when it is brighter than average. Compare with GetScreenHashDistance()
+	uint64_t GetFrameBufferPerceptualHash(void);
+	static UINT GetScreenHashDistance(uint64_t hash1, uint64_t hash2);
+
 	void VideoSaveSnapshot(class YamlSaveHelper& yamlSaveHelper);
 	void VideoLoadSnapshot(class YamlLoadHelper& yamlLoadHelper, UINT version);
 
@@ -168,8 +168,10 @@ void Win32Frame::Benchmark(void)
 
 	// PREPARE TWO DIFFERENT FRAME BUFFERS, EACH OF WHICH HAVE HALF OF THE
 	// BYTES SET TO 0x14 AND THE OTHER HALF SET TO 0xAA
+	// the video reads main memory directly
+	LPBYTE  memmain = MemGetMainPtr(0);
 	int     loop;
-	LPDWORD mem32 = (LPDWORD)mem;
+	LPDWORD mem32 = (LPDWORD)memmain;
 	for (loop = 4096; loop < 6144; loop++)
 		*(mem32 + loop) = ((loop & 1) ^ ((loop & 0x40) >> 6)) ? 0x14141414
 		: 0xAAAAAAAA;
@@ -183,7 +185,7 @@ void Win32Frame::Benchmark(void)
 	DWORD totaltextfps = 0;
 
 	video.SetVideoMode(VF_TEXT);
-	memset(mem + 0x400, 0x14, 0x400);
+	memset(memmain + 0x400, 0x14, 0x400);
 	VideoRedrawScreen();
 	DWORD milliseconds = GetTickCount();
 	while (GetTickCount() == milliseconds);
@@ -191,9 +193,9 @@ void Win32Frame::Benchmark(void)
 	DWORD cycle = 0;
 	do {
 		if (cycle & 1)
-			memset(mem + 0x400, 0x14, 0x400);
+			memset(memmain + 0x400, 0x14, 0x400);
 		else
-			memcpy(mem + 0x400, mem + ((cycle & 2) ? 0x4000 : 0x6000), 0x400);
+			memcpy(memmain + 0x400, memmain + ((cycle & 2) ? 0x4000 : 0x6000), 0x400);
 		VideoPresentScreen();
 		if (cycle++ >= 3)
 			cycle = 0;
@@ -205,7 +207,7 @@ void Win32Frame::Benchmark(void)
 	// SIMULATE THE ACTIVITY OF AN AVERAGE GAME
 	DWORD totalhiresfps = 0;
 	video.SetVideoMode(VF_HIRES);
-	memset(mem + 0x2000, 0x14, 0x2000);
+	memset(memmain + 0x2000, 0x14, 0x2000);
 	VideoRedrawScreen();
 	milliseconds = GetTickCount();
 	while (GetTickCount() == milliseconds);
@@ -213,9 +215,9 @@ void Win32Frame::Benchmark(void)
 	cycle = 0;
 	do {
 		if (cycle & 1)
-			memset(mem + 0x2000, 0x14, 0x2000);
+			memset(memmain + 0x2000, 0x14, 0x2000);
 		else
-			memcpy(mem + 0x2000, mem + ((cycle & 2) ? 0x4000 : 0x6000), 0x2000);
+			memcpy(memmain + 0x2000, memmain + ((cycle & 2) ? 0x4000 : 0x6000), 0x2000);
 		VideoPresentScreen();
 		if (cycle++ >= 3)
 			cycle = 0;
@@ -288,7 +290,7 @@ void Win32Frame::Benchmark(void)
 	// WITH FULL EMULATION OF THE CPU, JOYSTICK, AND DISK HAPPENING AT
 	// THE SAME TIME
 	DWORD realisticfps = 0;
-	memset(mem + 0x2000, 0xAA, 0x2000);
+	memset(memmain + 0x2000, 0xAA, 0x2000);
 	VideoRedrawScreen();
 	milliseconds = GetTickCount();
 	while (GetTickCount() == milliseconds);
@@ -304,9 +306,9 @@ void Win32Frame::Benchmark(void)
 			}
 		}
 		if (cycle & 1)
-			memset(mem + 0x2000, 0xAA, 0x2000);
+			memset(memmain + 0x2000, 0xAA, 0x2000);
 		else
-			memcpy(mem + 0x2000, mem + ((cycle & 2) ? 0x4000 : 0x6000), 0x2000);
+			memcpy(memmain + 0x2000, memmain + ((cycle & 2) ? 0x4000 : 0x6000), 0x2000);
 		VideoRedrawScreen();
 		if (cycle++ >= 3)
 			cycle = 0;
@@ -47,12 +47,33 @@ int YamlHelper::InitParser(const char* pPathname)
 	return 1;
 }
 
+int YamlHelper::InitParser(const BYTE* pData, const size_t size)
+{
+	const size_t kHdrSize = sizeof(SS_BINARY_MAGIC) + sizeof(UINT32);
+	if (size < kHdrSize || memcmp(pData, SS_BINARY_MAGIC, sizeof(SS_BINARY_MAGIC)) != 0)
+		return 0;
+
+	m_pBinData = pData;
+	m_binSize = size;
+	m_binPos = sizeof(SS_BINARY_MAGIC);
+	m_binMapPending = false;
+
+	if (ReadBinaryUint32() != SS_BINARY_VER)
+	{
+		m_pBinData = NULL;
+		return 0;
+	}
+
+	return 1;
+}
+
 void YamlHelper::FinaliseParser(void)
 {
 	if (m_hFile)
 		fclose(m_hFile);
 
 	m_hFile = NULL;
+	m_pBinData = NULL;
 
 	yaml_event_delete(&m_newEvent);
 	yaml_parser_delete(&m_parser);
@@ -101,6 +122,24 @@ void YamlHelper::GetNextEvent(void)
 
 int YamlHelper::GetScalar(std::string& scalar)
 {
+	if (m_pBinData)
+	{
+		if (m_binPos == m_binSize)
+			return 0;	// end of stream
+
+		const BYTE record = ReadBinaryByte();
+		if (record == SS_BINARY_MAP_END)
+			return 0;
+		if (record != SS_BINARY_MAP_BEGIN)
+			throw std::runtime_error("Save-state parser error: expected map");
+
+		ReadBinaryKey(m_scalarName);
+		scalar = m_scalarName;
+		ReadBinaryUint32();	// map's size
+		m_binMapPending = true;
+		return 1;
+	}
+
 	int res = 1;
 	bool bDone = false;
 
@@ -135,6 +174,14 @@ int YamlHelper::GetScalar(std::string& scalar)
 
 void YamlHelper::GetMapStartEvent(void)
 {
+	if (m_pBinData)
+	{
+		if (!m_binMapPending)
+			throw std::runtime_error("Unexpected binary save-state record");
+		m_binMapPending = false;
+		return;
+	}
+
 	GetNextEvent();
 
 	if (m_newEvent.type != YAML_MAPPING_START_EVENT)
@@ -146,7 +193,10 @@ void YamlHelper::GetMapStartEvent(void)
 
 int YamlHelper::ParseMap(MapYaml& mapYaml)
 {
-	mapYaml.clear();
+	if (m_pBinData)
+		return ParseMapBinary(mapYaml);
+
+	ClearMap(mapYaml);	// eg. the nodes kept from a binary save-state
 
 	const char*& pValue = (const char*&) m_newEvent.data.scalar.value;
 
@@ -206,26 +256,211 @@ int YamlHelper::ParseMap(MapYaml& mapYaml)
 	return res;
 }
 
+// The maps' nodes are kept from the last binary save-state, and just marked as not loaded (see EraseKey())
+// . successive save-states have (nearly) the same keys, so loading one doesn't allocate (eg. libretro's rewind & run-ahead)
+int YamlHelper::ParseMapBinary(MapYaml& mapYaml)
+{
+	for (MapYaml::iterator it = mapYaml.begin(); it != mapYaml.end(); ++it)
+		it->second.loaded = false;
+
+	while (m_binPos < m_binSize)
+	{
+		const BYTE record = ReadBinaryByte();
+		if (record == SS_BINARY_MAP_END)
+			return 1;
+
+		if (record < SS_BINARY_MAP_BEGIN || record > SS_BINARY_MEMORY)
+			throw std::runtime_error("Save-state parser error: unknown record");
+
+		UINT addr = 0;
+		if (record == SS_BINARY_MEMORY)
+		{
+			addr = ReadBinaryUint32();
+			char key[9];
+			snprintf(key, sizeof(key), "%04X", addr);
+			m_binKey = key;
+		}
+		else
+		{
+			ReadBinaryKey(m_binKey);
+		}
+
+		MapValue& mapValue = mapYaml[m_binKey];	// NB. only allocates for a key that wasn't in the last save-state
+		mapValue.loaded = true;
+
+		if (record == SS_BINARY_MAP_BEGIN)
+		{
+			ReadBinaryUint32();	// map's size
+			if (!mapValue.subMap)
+				mapValue.subMap = new MapYaml;
+			if (!ParseMapBinary(*mapValue.subMap))
+				throw std::runtime_error("ParseMap: premature end of data during map parsing");
+			continue;
+		}
+
+		if (mapValue.subMap)
+		{
+			ClearMap(*mapValue.subMap);
+			delete mapValue.subMap;
+			mapValue.subMap = NULL;
+		}
+		mapValue.value.clear();
+
+		switch (record)
+		{
+		case SS_BINARY_STRING:
+			{
+				mapValue.type = MapValue::kString;
+				const UINT length = ReadBinaryUint32();
+				if (length > m_binSize - m_binPos)
+					throw std::runtime_error("Save-state parser error: truncated data");
+				mapValue.value.assign((const char*)m_pBinData + m_binPos, length);
+				m_binPos += length;
+			}
+			break;
+		case SS_BINARY_INTEGER:
+			mapValue.type = MapValue::kInteger;
+			ReadBinary(&mapValue.integer, sizeof(mapValue.integer));
+			break;
+		case SS_BINARY_REAL:
+			mapValue.type = MapValue::kReal;
+			ReadBinary(&mapValue.real, sizeof(mapValue.real));
+			break;
+		case SS_BINARY_MEMORY:
+			mapValue.type = MapValue::kMemory;
+			mapValue.memorySize = ReadBinaryUint32();
+			if (mapValue.memorySize > m_binSize - m_binPos)
+				throw std::runtime_error("Save-state parser error: truncated data");
+			mapValue.memory = m_pBinData + m_binPos;
+			m_binPos += mapValue.memorySize;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+void YamlHelper::ReadBinary(void* pDst, const size_t size)
+{
+	if (size > m_binSize - m_binPos)
+		throw std::runtime_error("Save-state parser error: truncated data");
+
+	memcpy(pDst, m_pBinData + m_binPos, size);
+	m_binPos += size;
+}
+
+BYTE YamlHelper::ReadBinaryByte(void)
+{
+	BYTE value;
+	ReadBinary(&value, sizeof(value));
+	return value;
+}
+
+UINT YamlHelper::ReadBinaryUint32(void)
+{
+	UINT32 value;
+	ReadBinary(&value, sizeof(value));
+	return value;
+}
+
+void YamlHelper::ReadBinaryKey(std::string& key)
+{
+	const BYTE length = ReadBinaryByte();
+	if (length > m_binSize - m_binPos)
+		throw std::runtime_error("Save-state parser error: truncated data");
+
+	key.assign((const char*)m_pBinData + m_binPos, length);
+	m_binPos += length;
+}
+
+// As MapYaml::find(), but not a key that's been consumed (or isn't in this binary save-state)
+MapYaml::iterator YamlHelper::FindKey(MapYaml& mapYaml, const std::string& key)
+{
+	MapYaml::iterator iter = mapYaml.find(key);
+	if (iter != mapYaml.end() && !iter->second.loaded)
+		return mapYaml.end();
+	return iter;
+}
+
+// Consume a key
+// . a binary save-state keeps its node for the next save-state (see ParseMapBinary())
+void YamlHelper::EraseKey(MapYaml& mapYaml, MapYaml::iterator iter)
+{
+	if (m_pBinData)
+		iter->second.loaded = false;
+	else
+		mapYaml.erase(iter);
+}
+
+void YamlHelper::ClearMap(MapYaml& mapYaml)
+{
+	for (MapYaml::iterator iter = mapYaml.begin(); iter != mapYaml.end(); ++iter)
+	{
+		if (iter->second.subMap)
+		{
+			ClearMap(*iter->second.subMap);
+			delete iter->second.subMap;
+		}
+	}
+
+	mapYaml.clear();
+}
+
 std::string YamlHelper::GetMapValue(MapYaml& mapYaml, const std::string& key, bool& bFound)
 {
-	MapYaml::const_iterator iter = mapYaml.find(key);
+	MapYaml::iterator iter = FindKey(mapYaml, key);
 	if (iter == mapYaml.end() || iter->second.subMap != NULL)
 	{
 		bFound = false;	// not found
 		return "";
 	}
 
-	std::string value = iter->second.value;
+	std::string value;
+	switch (iter->second.type)
+	{
+	case MapValue::kInteger: value = StrFormat("%lld", (long long)iter->second.integer); break;	// eg. LoadString() of a SaveInt()
+	case MapValue::kReal: value = StrFormat("%f", iter->second.real); break;
+	default: value = iter->second.value; break;
+	}
 
-	mapYaml.erase(iter);
+	EraseKey(mapYaml, iter);
 
 	bFound = true;
 	return value;
 }
 
+// Binary save-state: get a value saved by SaveInt(), SaveHexUintN(), SaveBool(), etc. without converting to/from a string
+bool YamlHelper::GetMapInteger(MapYaml& mapYaml, const std::string& key, UINT64& value)
+{
+	MapYaml::iterator iter = FindKey(mapYaml, key);
+	if (iter == mapYaml.end() || iter->second.subMap != NULL || iter->second.type != MapValue::kInteger)
+		return false;
+
+	value = iter->second.integer;
+	EraseKey(mapYaml, iter);
+	return true;
+}
+
+bool YamlHelper::GetMapReal(MapYaml& mapYaml, const std::string& key, double& value)
+{
+	MapYaml::iterator iter = FindKey(mapYaml, key);
+	if (iter == mapYaml.end() || iter->second.subMap != NULL)
+		return false;
+
+	if (iter->second.type == MapValue::kReal)
+		value = iter->second.real;
+	else if (iter->second.type == MapValue::kInteger)
+		value = (double)(INT64)iter->second.integer;
+	else
+		return false;
+
+	EraseKey(mapYaml, iter);
+	return true;
+}
+
 bool YamlHelper::GetSubMap(MapYaml** mapYaml, const std::string& key, const bool canBeNull/*=false*/)
 {
-	MapYaml::const_iterator iter = (*mapYaml)->find(key);
+	MapYaml::iterator iter = FindKey(**mapYaml, key);
 	if (iter == (*mapYaml)->end() || (!canBeNull && iter->second.subMap == NULL))
 	{
 		return false;	// not found
@@ -239,21 +474,29 @@ void YamlHelper::GetMapRemainder(std::string& mapName, MapYaml& mapYaml)
 {
 	for (MapYaml::iterator iter = mapYaml.begin(); iter != mapYaml.end(); ++iter)
 	{
+		if (!iter->second.loaded)
+			continue;	// binary save-state: consumed, or not in this one
+
 		if (iter->second.subMap)
 		{
 			std::string subMapName(iter->first);
 			GetMapRemainder(subMapName, *iter->second.subMap);
-			delete iter->second.subMap;
+			if (m_pBinData)
+				iter->second.loaded = false;
+			else
+				delete iter->second.subMap;
 		}
 		else
 		{
 			const char* pKey = iter->first.c_str();
 			LogOutput("%s: Unknown key (%s)\n", mapName.c_str(), pKey);
 			LogFileOutput("%s: Unknown key (%s)\n", mapName.c_str(), pKey);
+			iter->second.loaded = false;
 		}
 	}
 
-	mapYaml.clear();
+	if (!m_pBinData)
+		mapYaml.clear();
 }
 
 //
@@ -278,6 +521,9 @@ UINT YamlHelper::LoadMemory(MapYaml& mapYaml, const LPBYTE pMemBase, const size_
 
 	for (MapYaml::iterator it = mapYaml.begin(); it != mapYaml.end(); ++it)
 	{
+		if (!it->second.loaded)
+			continue;	// binary save-state: not in this one
+
 		const char* pKey = it->first.c_str();
 		UINT addr = strtoul(pKey, NULL, 16);
 		if (addr >= (kAddrSpaceSize + offset))
@@ -289,6 +535,17 @@ UINT YamlHelper::LoadMemory(MapYaml& mapYaml, const LPBYTE pMemBase, const size_
 		if (it->second.subMap)
 			throw std::runtime_error("Memory: unexpected sub-map");
 
+		if (it->second.type == MapValue::kMemory)	// binary save-state
+		{
+			if (it->second.memorySize > (size_t)(pDstEnd - pDst))
+				throw std::runtime_error("Memory: data overflowed address space on address: " + it->first);
+
+			memcpy(pDst, it->second.memory, it->second.memorySize);
+			bytes += it->second.memorySize;
+			it->second.loaded = false;
+			continue;
+		}
+
 		const char* pValue = it->second.value.c_str();
 		size_t len = strlen(pValue);
 		if (len & 1)
@@ -309,7 +566,8 @@ UINT YamlHelper::LoadMemory(MapYaml& mapYaml, const LPBYTE pMemBase, const size_
 		}
 	}
 
-	mapYaml.clear();
+	if (!m_pBinData)
+		mapYaml.clear();
 
 	return bytes;
 }
@@ -318,6 +576,10 @@ UINT YamlHelper::LoadMemory(MapYaml& mapYaml, const LPBYTE pMemBase, const size_
 
 INT YamlLoadHelper::LoadInt(const std::string key)
 {
+	UINT64 number;
+	if (m_yamlHelper.GetMapInteger(*m_pMapYaml, key, number))
+		return (INT)number;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "")
@@ -330,6 +592,10 @@ INT YamlLoadHelper::LoadInt(const std::string key)
 
 UINT YamlLoadHelper::LoadUint(const std::string key)
 {
+	UINT64 number;
+	if (m_yamlHelper.GetMapInteger(*m_pMapYaml, key, number))
+		return (UINT)number;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "")
@@ -342,6 +608,10 @@ UINT YamlLoadHelper::LoadUint(const std::string key)
 
 UINT64 YamlLoadHelper::LoadUint64(const std::string key)
 {
+	UINT64 number;
+	if (m_yamlHelper.GetMapInteger(*m_pMapYaml, key, number))
+		return number;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "")
@@ -354,6 +624,10 @@ UINT64 YamlLoadHelper::LoadUint64(const std::string key)
 
 bool YamlLoadHelper::LoadBool(const std::string key)
 {
+	UINT64 number;
+	if (m_yamlHelper.GetMapInteger(*m_pMapYaml, key, number))
+		return number ? true : false;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "true")
@@ -384,6 +658,10 @@ std::string YamlLoadHelper::LoadString(const std::string& key)
 
 float YamlLoadHelper::LoadFloat(const std::string& key)
 {
+	double real;
+	if (m_yamlHelper.GetMapReal(*m_pMapYaml, key, real))
+		return (float)real;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "")
@@ -400,6 +678,10 @@ float YamlLoadHelper::LoadFloat(const std::string& key)
 
 double YamlLoadHelper::LoadDouble(const std::string& key)
 {
+	double real;
+	if (m_yamlHelper.GetMapReal(*m_pMapYaml, key, real))
+		return real;
+
 	bool bFound;
 	std::string value = m_yamlHelper.GetMapValue(*m_pMapYaml, key, bFound);
 	if (value == "")
@@ -426,66 +708,132 @@ void YamlLoadHelper::LoadMemory(std::vector<BYTE>& memory, const size_t size, co
 
 void YamlSaveHelper::Save(const char* format, ...)
 {
-	fwrite(m_szIndent, 1, m_indent, m_hFile);
-
 	va_list vl;
 	va_start(vl, format);
-	vfprintf(m_hFile, format, vl);
+
+	if (m_isBinary)
+	{
+		char line[512];
+		vsnprintf(line, sizeof(line), format, vl);
+		WriteBinaryLine(line);
+	}
+	else
+	{
+		fwrite(m_szIndent, 1, m_indent, m_hFile);
+		vfprintf(m_hFile, format, vl);
+	}
+
 	va_end(vl);
 }
 
 void YamlSaveHelper::SaveInt(const char* key, int value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, (UINT64)(INT64)value);
+		return;
+	}
 	Save("%s: %d\n", key, value);
 }
 
 void YamlSaveHelper::SaveUint(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: %u\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint4(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value & 0xf);
+		return;
+	}
 	Save("%s: 0x%01X\n", key, value & 0xf);
 }
 
 void YamlSaveHelper::SaveHexUint8(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%02X\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint12(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%03X\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint16(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%04X\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint24(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%06X\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint32(const char* key, UINT value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%08X\n", key, value);
 }
 
 void YamlSaveHelper::SaveHexUint64(const char* key, UINT64 value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value);
+		return;
+	}
 	Save("%s: 0x%016llX\n", key, value);
 }
 
 void YamlSaveHelper::SaveBool(const char* key, bool value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryInteger(key, value ? 1 : 0);
+		return;
+	}
 	Save("%s: %s\n", key, value ? "true" : "false");
 }
 
 void YamlSaveHelper::SaveString(const char* key,  const char* value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryString(key, value, strlen(value));	// NB. no need for UTF-8 conversion
+		return;
+	}
+
 	if (value[0] == 0)
 		value = "\"\"";
 
@@ -538,11 +886,21 @@ void YamlSaveHelper::SaveString(const char* key, const std::string & value)
 
 void YamlSaveHelper::SaveFloat(const char* key, float value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryReal(key, value);
+		return;
+	}
 	Save("%s: %f\n", key, value);
 }
 
 void YamlSaveHelper::SaveDouble(const char* key, double value)
 {
+	if (m_isBinary)
+	{
+		WriteBinaryReal(key, value);
+		return;
+	}
 	Save("%s: %f\n", key, value);
 }
 
@@ -552,6 +910,18 @@ void YamlSaveHelper::SaveMemory(const LPBYTE pMemBase, const UINT uMemSize, cons
 	if (uMemSize & 7)
 		throw std::runtime_error("Memory: size must be multiple of 8");
 
+	if (m_isBinary)
+	{
+		const BYTE record = SS_BINARY_MEMORY;
+		const UINT32 addr = offset;
+		const UINT32 size = uMemSize;
+		WriteBinary(&record, sizeof(record));
+		WriteBinary(&addr, sizeof(addr));
+		WriteBinary(&size, sizeof(size));
+		WriteBinary(pMemBase + offset, uMemSize);
+		return;
+	}
+
 	const UINT kIndent = m_indent;
 
 	const UINT kStride = 64;
@@ -605,6 +975,19 @@ void YamlSaveHelper::SaveMemory(const LPBYTE pMemBase, const UINT uMemSize, cons
 
 void YamlSaveHelper::FileHdr(UINT version)
 {
+	if (m_isBinary)
+	{
+		const UINT32 binaryVersion = SS_BINARY_VER;
+		WriteBinary(SS_BINARY_MAGIC, sizeof(SS_BINARY_MAGIC));
+		WriteBinary(&binaryVersion, sizeof(binaryVersion));
+
+		WriteBinaryMapBegin(SS_YAML_KEY_FILEHDR);
+		SaveString(SS_YAML_KEY_TAG, SS_YAML_VALUE_AWSS);
+		SaveInt(SS_YAML_KEY_VERSION, version);
+		WriteBinaryMapEnd();
+		return;
+	}
+
 	fprintf(m_hFile, "%s:\n", SS_YAML_KEY_FILEHDR);
 	m_indent = 2;
 	SaveString(SS_YAML_KEY_TAG, SS_YAML_VALUE_AWSS);
@@ -613,8 +996,164 @@ void YamlSaveHelper::FileHdr(UINT version)
 
 void YamlSaveHelper::UnitHdr(const std::string& type, UINT version)
 {
+	if (m_isBinary)
+	{
+		// A YAML unit's map ends implicitly at the next unit, but binary maps need an explicit end
+		if (m_binUnitOpen)
+			WriteBinaryMapEnd();
+
+		WriteBinaryMapBegin(SS_YAML_KEY_UNIT);
+		m_binUnitOpen = true;
+		m_indent = 2;
+		SaveString(SS_YAML_KEY_TYPE, type.c_str());
+		SaveInt(SS_YAML_KEY_VERSION, version);
+		return;
+	}
+
 	fprintf(m_hFile, "\n%s:\n", SS_YAML_KEY_UNIT);
 	m_indent = 2;
 	SaveString(SS_YAML_KEY_TYPE, type.c_str());
 	SaveInt(SS_YAML_KEY_VERSION, version);
 }
+
+// Returns the size of the binary save-state (which may be bigger than the buffer passed to the constructor)
+size_t YamlSaveHelper::FinaliseBinary(void)
+{
+	_ASSERT(m_isBinary);
+
+	if (m_binUnitOpen)
+	{
+		WriteBinaryMapEnd();
+		m_binUnitOpen = false;
+	}
+
+	_ASSERT(m_binMapDepth == 0);
+	return m_binPos;
+}
+
+bool YamlSaveHelper::BeginLabel(const char* format, va_list vl)
+{
+	if (!m_isBinary)
+	{
+		fwrite(m_szIndent, 1, m_indent, m_hFile);
+		vfprintf(m_hFile, format, vl);
+		return false;
+	}
+
+	char label[256];
+	vsnprintf(label, sizeof(label), format, vl);
+
+	size_t length = strlen(label);
+	while (length && (label[length-1] == '\n' || label[length-1] == ' '))
+		label[--length] = 0;
+
+	// eg. "State: null"
+	const char* kNull = ": null";
+	const size_t kNullLength = strlen(kNull);
+	if (length > kNullLength && strcmp(&label[length-kNullLength], kNull) == 0)
+	{
+		label[length-kNullLength] = 0;
+		WriteBinaryString(label, "null", 4);
+		return false;
+	}
+
+	if (length && label[length-1] == ':')
+		label[--length] = 0;
+
+	WriteBinaryMapBegin(label);
+	return true;
+}
+
+void YamlSaveHelper::EndLabel(void)
+{
+	WriteBinaryMapEnd();
+}
+
+void YamlSaveHelper::WriteBinary(const void* pData, const size_t size)
+{
+	// Once the buffer has overflowed, just keep counting the size
+	if (m_binPos + size <= m_binBufferSize)
+		memcpy(m_pBinBuffer + m_binPos, pData, size);
+
+	m_binPos += size;
+}
+
+void YamlSaveHelper::WriteBinaryKey(BYTE record, const char* key)
+{
+	const size_t length = strlen(key);
+	if (length > 0xFF)
+		throw std::runtime_error("Save error: key too long: " + std::string(key));
+
+	const BYTE keyLength = (BYTE)length;
+	WriteBinary(&record, sizeof(record));
+	WriteBinary(&keyLength, sizeof(keyLength));
+	WriteBinary(key, length);
+}
+
+void YamlSaveHelper::WriteBinaryMapBegin(const char* key)
+{
+	if (m_binMapDepth >= kMaxIndent/2)
+		throw std::runtime_error("Save error: maps nested too deeply");
+
+	WriteBinaryKey(SS_BINARY_MAP_BEGIN, key);
+
+	m_binMapStart[m_binMapDepth++] = m_binPos;
+	const UINT32 size = 0;	// patched by WriteBinaryMapEnd()
+	WriteBinary(&size, sizeof(size));
+}
+
+void YamlSaveHelper::WriteBinaryMapEnd(void)
+{
+	_ASSERT(m_binMapDepth);
+	const BYTE record = SS_BINARY_MAP_END;
+	WriteBinary(&record, sizeof(record));
+
+	const size_t start = m_binMapStart[--m_binMapDepth];
+	const UINT32 size = (UINT32)(m_binPos - (start + sizeof(UINT32)));
+	if (start + sizeof(size) <= m_binBufferSize)
+		memcpy(m_pBinBuffer + start, &size, sizeof(size));
+}
+
+void YamlSaveHelper::WriteBinaryString(const char* key, const char* value, const size_t length)
+{
+	const UINT32 size = (UINT32)length;
+	WriteBinaryKey(SS_BINARY_STRING, key);
+	WriteBinary(&size, sizeof(size));
+	WriteBinary(value, length);
+}
+
+void YamlSaveHelper::WriteBinaryInteger(const char* key, UINT64 value)
+{
+	WriteBinaryKey(SS_BINARY_INTEGER, key);
+	WriteBinary(&value, sizeof(value));
+}
+
+void YamlSaveHelper::WriteBinaryReal(const char* key, double value)
+{
+	WriteBinaryKey(SS_BINARY_REAL, key);
+	WriteBinary(&value, sizeof(value));
+}
+
+// Convert a pre-formatted YAML line (see Save()) to a string value, eg:
+// "Num Aux Banks: 0x01   # comment\n" -> key="Num Aux Banks", value="0x01"
+void YamlSaveHelper::WriteBinaryLine(const char* line)
+{
+	const char* pSeparator = strstr(line, ": ");
+	if (!pSeparator)
+		throw std::runtime_error("Save error: expected 'key: value': " + std::string(line));
+
+	char key[256];
+	const size_t keyLength = pSeparator - line;
+	if (keyLength >= sizeof(key))
+		throw std::runtime_error("Save error: key too long: " + std::string(line));
+	memcpy(key, line, keyLength);
+	key[keyLength] = 0;
+
+	const char* pValue = pSeparator + 2;
+	const char* pComment = strstr(pValue, " #");
+	size_t length = pComment ? (size_t)(pComment - pValue) : strlen(pValue);
+	while (length && (pValue[length-1] == '\n' || pValue[length-1] == ' '))
+		length--;
+
+	WriteBinaryString(key, pValue, length);
+}
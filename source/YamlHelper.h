@@ -15,13 +15,51 @@
 
 #define SS_YAML_VALUE_AWSS "AppleWin Save State"
 
+// Binary (in-memory) save-state
+// . Same hierarchy of maps & keys as the YAML save-state, but values are stored in their native form
+//   (so no formatting/parsing of hex), and each map is a length-prefixed chunk.
+// . Host byte order: intended for quick-save/rewind, not as an interchange format (use YAML for that).
+#define SS_BINARY_MAGIC "AWSSBIN"	// 8 bytes, including null terminator
+#define SS_BINARY_VER 1
+
+enum SS_BINARY_RECORD
+{
+	SS_BINARY_MAP_BEGIN = 1,	// key, UINT32 size of map's records (including SS_BINARY_MAP_END)
+	SS_BINARY_MAP_END,
+	SS_BINARY_STRING,			// key, UINT32 length, chars
+	SS_BINARY_INTEGER,			// key, UINT64
+	SS_BINARY_REAL,				// key, double
+	SS_BINARY_MEMORY,			// UINT32 address, UINT32 size, bytes
+};
+// NB. a key is a BYTE length followed by its chars
+
 struct MapValue;
 typedef std::map<std::string, MapValue> MapYaml;
 
 struct MapValue
 {
+	MapValue() :
+		subMap(NULL),
+		type(kString),
+		integer(0),
+		real(0.0),
+		memory(NULL),
+		memorySize(0),
+		loaded(true)
+	{}
+
+	enum Type { kString, kInteger, kReal, kMemory };
+
 	std::string value;
 	MapYaml* subMap;
+
+	// Binary save-state only (YAML values are always strings)
+	Type type;
+	UINT64 integer;
+	double real;
+	const BYTE* memory;		// points into the save-state buffer
+	UINT memorySize;
+	bool loaded;			// false once consumed, as a binary save-state keeps the node for the next one (see ParseMapBinary())
 };
 
 class YamlHelper
@@ -30,7 +68,11 @@ friend class YamlLoadHelper;	// YamlLoadHelper can access YamlHelper's private m
 
 public:
 	YamlHelper(void) :
-		m_hFile(NULL)
+		m_hFile(NULL),
+		m_pBinData(NULL),
+		m_binSize(0),
+		m_binPos(0),
+		m_binMapPending(false)
 	{
 		memset(&m_parser, 0, sizeof(m_parser));
 		memset(&m_newEvent, 0, sizeof(m_newEvent));
@@ -40,9 +82,11 @@ public:
 	~YamlHelper(void)
 	{
 		FinaliseParser();
+		ClearMap(m_mapYaml);
 	}
 
 	int InitParser(const char* pPathname);
+	int InitParser(const BYTE* pData, const size_t size);	// binary save-state
 	void FinaliseParser(void);
 
 	UINT ParseFileHdr(const char* tag);
@@ -53,13 +97,24 @@ public:
 private:
 	void GetNextEvent(void);
 	int ParseMap(MapYaml& mapYaml);
+	MapYaml::iterator FindKey(MapYaml& mapYaml, const std::string& key);
+	void EraseKey(MapYaml& mapYaml, MapYaml::iterator iter);
+	static void ClearMap(MapYaml& mapYaml);
 	std::string GetMapValue(MapYaml& mapYaml, const std::string &key, bool& bFound);
+	bool GetMapInteger(MapYaml& mapYaml, const std::string &key, UINT64& value);
+	bool GetMapReal(MapYaml& mapYaml, const std::string &key, double& value);
 	UINT LoadMemory(MapYaml& mapYaml, const LPBYTE pMemBase, const size_t kAddrSpaceSize, const UINT offset);
 	bool GetSubMap(MapYaml** mapYaml, const std::string &key, const bool canBeNull=false);
 	void GetMapRemainder(std::string& mapName, MapYaml& mapYaml);
 
 	void MakeAsciiToHexTable(void);
 
+	int ParseMapBinary(MapYaml& mapYaml);
+	void ReadBinary(void* pDst, const size_t size);
+	BYTE ReadBinaryByte(void);
+	UINT ReadBinaryUint32(void);
+	void ReadBinaryKey(std::string& key);
+
 	yaml_parser_t m_parser;
 	yaml_event_t m_newEvent;
 
@@ -68,6 +123,12 @@ private:
 	FILE* m_hFile;
 	char m_AsciiToHex[256];
 
+	const BYTE* m_pBinData;		// non-NULL when parsing a binary save-state
+	size_t m_binSize;
+	size_t m_binPos;
+	bool m_binMapPending;		// GetScalar() has read a SS_BINARY_MAP_BEGIN for GetMapStartEvent()
+	std::string m_binKey;
+
 	MapYaml m_mapYaml;
 };
 
@@ -140,6 +201,9 @@ public:
 			m_bIteratingOverMap = true;
 		}
 
+		while (m_iter != m_pMapYaml->end() && !m_iter->second.loaded)
+			++m_iter;	// binary save-state: not in this one
+
 		if (m_iter == m_pMapYaml->end())
 		{
 			m_bIteratingOverMap = false;
@@ -181,7 +245,13 @@ public:
 		m_pWcStr(NULL),
 		m_wcStrSize(0),
 		m_pMbStr(NULL),
-		m_mbStrSize(0)
+		m_mbStrSize(0),
+		m_isBinary(false),
+		m_pBinBuffer(NULL),
+		m_binBufferSize(0),
+		m_binPos(0),
+		m_binMapDepth(0),
+		m_binUnitOpen(false)
 	{
 		m_hFile = fopen(pathname.c_str(), "wt");
 
@@ -205,6 +275,26 @@ public:
 		memset(m_szIndent, ' ', kMaxIndent);
 	}
 
+	// Binary save-state to a caller-provided buffer (no file I/O, no heap allocation)
+	// . If the buffer is too small (or NULL) then nothing is written past its end, but the size is still counted:
+	//   so FinaliseBinary() returns the size actually needed.
+	YamlSaveHelper(BYTE* pBuffer, const size_t size) :
+		m_hFile(NULL),
+		m_indent(0),
+		m_pWcStr(NULL),
+		m_wcStrSize(0),
+		m_pMbStr(NULL),
+		m_mbStrSize(0),
+		m_isBinary(true),
+		m_pBinBuffer(pBuffer),
+		m_binBufferSize(pBuffer ? size : 0),
+		m_binPos(0),
+		m_binMapDepth(0),
+		m_binUnitOpen(false)
+	{
+		memset(m_szIndent, ' ', kMaxIndent);
+	}
+
 	~YamlSaveHelper()
 	{
 		if (m_hFile)
@@ -241,11 +331,9 @@ public:
 		Label(YamlSaveHelper& rYamlSaveHelper, const char* format, ...)  ATTRIBUTE_FORMAT_PRINTF(3, 4) :  // 1 is "this"
 			yamlSaveHelper(rYamlSaveHelper)
 		{
-			fwrite(yamlSaveHelper.m_szIndent, 1, yamlSaveHelper.m_indent, yamlSaveHelper.m_hFile);
-
 			va_list vl;
 			va_start(vl, format);
-			vfprintf(yamlSaveHelper.m_hFile, format, vl);
+			isMap = yamlSaveHelper.BeginLabel(format, vl);
 			va_end(vl);
 
 			yamlSaveHelper.m_indent += 2;
@@ -256,9 +344,13 @@ public:
 		{
 			yamlSaveHelper.m_indent -= 2;
 			_ASSERT(yamlSaveHelper.m_indent >= 0);
+
+			if (isMap)
+				yamlSaveHelper.EndLabel();
 		}
 
 		YamlSaveHelper& yamlSaveHelper;
+		bool isMap;
 	};
 
 	class Slot : public Label
@@ -277,7 +369,22 @@ public:
 	void FileHdr(UINT version);
 	void UnitHdr(const std::string & type, UINT version);
 
+	bool IsBinary(void) { return m_isBinary; }
+	size_t FinaliseBinary(void);
+
 private:
+	bool BeginLabel(const char* format, va_list vl);
+	void EndLabel(void);
+
+	void WriteBinary(const void* pData, const size_t size);
+	void WriteBinaryKey(BYTE record, const char* key);
+	void WriteBinaryMapBegin(const char* key);
+	void WriteBinaryMapEnd(void);
+	void WriteBinaryString(const char* key, const char* value, const size_t length);
+	void WriteBinaryInteger(const char* key, UINT64 value);
+	void WriteBinaryReal(const char* key, double value);
+	void WriteBinaryLine(const char* line);
+
 	FILE* m_hFile;
 
 	int m_indent;
@@ -288,4 +395,12 @@ private:
 	int m_wcStrSize;
 	LPSTR m_pMbStr;
 	int m_mbStrSize;
+
+	bool m_isBinary;
+	BYTE* m_pBinBuffer;
+	size_t m_binBufferSize;
+	size_t m_binPos;
+	size_t m_binMapStart[kMaxIndent/2];	// position of each open map's size field (to patch on SS_BINARY_MAP_END)
+	UINT m_binMapDepth;
+	bool m_binUnitOpen;
 };
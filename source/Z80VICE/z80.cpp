@@ -6391,7 +6391,7 @@ BYTE z80_RDMEM(WORD Addr)
 			}
 			else
 			{
-				return *(mem+addr);
+				return ReadByteFromMemory(addr);
 			}
 		break;
 
@@ -0,0 +1,332 @@
+#include "StdAfx.h"
+#include "frontends/common2/batch.h"
+#include "frontends/common2/programoptions.h"
+#include "frontends/common2/headlessframe.h"
+#include "frontends/common2/commoncontext.h"
+#include "frontends/common2/fileregistry.h"
+#include "linux/context.h"
+#include "linux/paddle.h"
+
+#include "CardManager.h"
+#include "Core.h"
+#include "CPU.h"
+#include "Disk.h"
+#include "Harddisk.h"
+#include "Interface.h"
+#include "NTSC.h"
+#include "Video.h"
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+  struct Job
+  {
+    size_t index;
+    int fd;
+  };
+
+  std::vector<std::string> readImageList(const std::string & filename)
+  {
+    std::ifstream input(filename);
+    if (!input)
+    {
+      throw std::runtime_error("Cannot open batch file: " + filename);
+    }
+
+    std::vector<std::string> images;
+    std::string line;
+    while (std::getline(input, line))
+    {
+      const size_t last = line.find_last_not_of(" \t\r");
+      line.erase(last == std::string::npos ? 0 : last + 1);
+      // skip empty lines and comments
+      if (!line.empty() && line[0] != '#')
+      {
+        images.push_back(line);
+      }
+    }
+    return images;
+  }
+
+  bool isHardDisk(const std::string & image)
+  {
+    const size_t dot = image.find_last_of('.');
+    if (dot == std::string::npos)
+    {
+      return false;
+    }
+
+    std::string extension = image.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == "hdv";
+  }
+
+  std::string quote(const std::string & value)
+  {
+    std::string result = "\"";
+    for (const char c : value)
+    {
+      if (c == '"')
+      {
+        result += '"';
+      }
+      result += c;
+    }
+    result += '"';
+    return result;
+  }
+
+  uint64_t hashFrameBuffer()
+  {
+    Video & video = GetVideo();
+    const uint8_t * data = video.GetFrameBuffer();
+    const size_t size = video.GetFrameBufferWidth() * video.GetFrameBufferHeight() * sizeof(bgra_t);
+
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash ^= data[i];
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  }
+
+  bool isImageInserted(const bool hardDisk)
+  {
+    CardManager & cardManager = GetCardMgr();
+    if (hardDisk)
+    {
+      return cardManager.QuerySlot(SLOT7) == CT_GenericHDD &&
+        !dynamic_cast<HarddiskInterfaceCard &>(cardManager.GetRef(SLOT7)).GetFullName(HARDDISK_1).empty();
+    }
+    else
+    {
+      return cardManager.QuerySlot(SLOT6) == CT_Disk2 &&
+        !dynamic_cast<Disk2InterfaceCard &>(cardManager.GetRef(SLOT6)).IsDriveEmpty(DRIVE_1);
+    }
+  }
+
+  std::string runImage(const common2::EmulatorOptions & options, const std::string & image)
+  {
+    common2::EmulatorOptions imageOptions = options;
+    const bool hardDisk = isHardDisk(image);
+    if (hardDisk)
+    {
+      imageOptions.hardDisk1 = image;
+    }
+    else
+    {
+      imageOptions.disk1 = image;
+    }
+    imageOptions.autoBoot = true;
+    imageOptions.noRender = true;  // same CPU results as a rendered run
+    imageOptions.noAudio = true;
+    imageOptions.loadSnapshot = false;
+    imageOptions.wavFileSpeaker.clear();
+    imageOptions.wavFileMockingboard.clear();
+
+    const RegistryContext registryContext(common2::CreateFileRegistry(imageOptions));
+    const std::shared_ptr<common2::HeadlessFrame> frame = std::make_shared<common2::HeadlessFrame>(imageOptions);
+    const std::shared_ptr<Paddle> paddle = std::make_shared<Paddle>();
+    const common2::CommonInitialisation init(frame, paddle, imageOptions);
+
+    if (!isImageInserted(hardDisk))
+    {
+      throw std::runtime_error("cannot insert image");
+    }
+
+    const uint64_t startCycles = g_nCumulativeCycles;
+    const auto start = std::chrono::steady_clock::now();
+
+    Video & video = GetVideo();
+    bool reached = false;
+    if (options.batchStopHash)
+    {
+      // check the video memory after each frame: this needs no rendering
+      const uint64_t cyclesPerFrame = NTSC_GetCyclesPerFrame();
+      uint64_t executed = 0;
+      while (!reached && executed < options.batchCycles && g_nAppMode == MODE_RUNNING)
+      {
+        frame->ExecuteCycles(std::min(cyclesPerFrame, options.batchCycles - executed));
+        executed = g_nCumulativeCycles - startCycles;
+        reached = video.GetScreenHash() == *options.batchStopHash;
+      }
+    }
+    else
+    {
+      frame->ExecuteCycles(options.batchCycles);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const uint64_t cycles = g_nCumulativeCycles - startCycles;
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double mhz = seconds > 0.0 ? cycles / seconds / 1.0e6 : 0.0;
+
+    // nothing is rendered while running: draw the final screen once
+    NTSC_VideoRedrawWholeScreen();
+    const uint64_t screenHash = hashFrameBuffer();
+    const uint64_t videoHash = video.GetScreenHash();
+    const uint64_t perceptualHash = video.GetFrameBufferPerceptualHash();
+
+    std::ostringstream line;
+    line << quote(image) << ",ok,"
+         << std::hex << std::uppercase << std::setfill('0') << std::setw(4) << regs.pc << ','
+         << std::dec << cycles << ','
+         << std::fixed << std::setprecision(3) << seconds << ','
+         << std::setprecision(2) << mhz << ','
+         << std::hex << std::setw(16) << screenHash << ','
+         << std::setw(16) << videoHash << ','
+         << std::setw(16) << perceptualHash << ','
+         << (options.batchStopHash ? (reached ? "1" : "0") : "") << '\n';
+    return line.str();
+  }
+
+  std::string describeStatus(const int status)
+  {
+    if (WIFSIGNALED(status))
+    {
+      return "signal " + std::to_string(WTERMSIG(status));
+    }
+    return "exit " + std::to_string(WEXITSTATUS(status));
+  }
+
+  void writeAll(const int fd, const std::string & data)
+  {
+    size_t done = 0;
+    while (done < data.size())
+    {
+      const ssize_t written = write(fd, data.data() + done, data.size() - done);
+      if (written <= 0)
+      {
+        break;
+      }
+      done += written;
+    }
+  }
+
+  std::string readAll(const int fd)
+  {
+    std::string data;
+    char buffer[4096];
+    ssize_t rd;
+    while ((rd = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+      data.append(buffer, rd);
+    }
+    return data;
+  }
+
+}
+
+namespace common2
+{
+
+  int runBatch(const EmulatorOptions & options)
+  {
+    const std::vector<std::string> images = readImageList(options.batchFile);
+    const size_t jobs = options.batchJobs ? options.batchJobs : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::string> results(images.size());
+    std::map<pid_t, Job> running;
+    size_t next = 0;
+    size_t failures = 0;
+
+    while (next < images.size() || !running.empty())
+    {
+      while (next < images.size() && running.size() < jobs)
+      {
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+          throw std::runtime_error("Batch: cannot create pipe");
+        }
+
+        const pid_t pid = fork();
+        if (pid < 0)
+        {
+          throw std::runtime_error("Batch: cannot fork");
+        }
+
+        if (pid == 0)
+        {
+          // child: a result line is much smaller than the pipe buffer, so this never blocks
+          close(fds[0]);
+          int code = 0;
+          try
+          {
+            writeAll(fds[1], runImage(options, images[next]));
+          }
+          catch (const std::exception & e)
+          {
+            std::cerr << images[next] << ": " << e.what() << std::endl;
+            code = 1;
+          }
+          close(fds[1]);
+          _exit(code);
+        }
+
+        close(fds[1]);
+        running[pid] = {next, fds[0]};
+        ++next;
+      }
+
+      int status = 0;
+      const pid_t pid = waitpid(-1, &status, 0);
+      if (pid < 0)
+      {
+        throw std::runtime_error("Batch: waitpid failed");
+      }
+
+      const auto it = running.find(pid);
+      if (it == running.end())
+      {
+        continue;
+      }
+
+      std::string & result = results[it->second.index];
+      result = readAll(it->second.fd);
+      close(it->second.fd);
+
+      if (result.empty())
+      {
+        result = quote(images[it->second.index]) + ",failed (" + describeStatus(status) + "),,,,,,,,\n";
+        ++failures;
+      }
+      running.erase(it);
+    }
+
+    std::ofstream file;
+    if (!options.batchOutput.empty())
+    {
+      file.open(options.batchOutput);
+      if (!file)
+      {
+        throw std::runtime_error("Cannot open batch output: " + options.batchOutput);
+      }
+    }
+    std::ostream & output = options.batchOutput.empty() ? std::cout : file;
+
+    output << "image,status,pc,cycles,seconds,mhz,screen_hash,video_hash,perceptual_hash,stop_hash_reached\n";
+    for (const std::string & result : results)
+    {
+      output << result;
+    }
+
+    return failures ? 1 : 0;
+  }
+
+}
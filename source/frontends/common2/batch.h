@@ -0,0 +1,16 @@
+#pragma once
+
+namespace common2
+{
+
+  struct EmulatorOptions;
+
+  // boot every image listed in options.batchFile for options.batchCycles
+  // and write one CSV line per image (final PC, screen hashes, speed)
+  // with options.batchStopHash an image stops as soon as its video hash (Video::GetScreenHash) matches
+  //
+  // the emulator core is a process wide singleton
+  // so each image runs in its own forked process, options.batchJobs at a time
+  int runBatch(const EmulatorOptions & options);
+
+}
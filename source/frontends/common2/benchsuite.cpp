@@ -0,0 +1,448 @@
+#include "StdAfx.h"
+#include "frontends/common2/benchsuite.h"
+#include "frontends/common2/programoptions.h"
+#include "frontends/common2/headlessframe.h"
+#include "frontends/common2/commoncontext.h"
+#include "frontends/common2/ptreeregistry.h"
+#include "linux/context.h"
+#include "linux/paddle.h"
+#include "linux/version.h"
+
+#include "Card.h"
+#include "CardManager.h"
+#include "Common.h"
+#include "Core.h"
+#include "CPU.h"
+#include "Disk.h"
+#include "Memory.h"
+#include "Registry.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#ifdef LOG_PERF_TIMINGS
+// Core.cpp
+extern UINT64 g_timeCpu;
+extern UINT64 g_timeVideo;
+extern UINT64 g_timeMB_Timer;
+extern UINT64 g_timeMB_NoTimer;
+extern UINT64 g_timeSpeaker;
+#endif
+
+namespace
+{
+
+  struct Workload
+  {
+    const char * name;
+    const char * description;
+    eApple2Type model;
+    SS_CARDTYPE slot4;
+    bool videoUpdate;
+    bool disk;
+    void (*setup)();
+  };
+
+  struct Result
+  {
+    uint64_t cycles;
+    double seconds;
+#ifdef LOG_PERF_TIMINGS
+    uint64_t instructions;
+    double cpu, video, mockingboard, speaker;
+#endif
+  };
+
+  void writeMain(const WORD address, const std::vector<BYTE> & code)
+  {
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+      WriteByteToMemory(address + i, code[i]);
+    }
+  }
+
+  void setupCpu6502()
+  {
+    // the loop used by VideoBenchmark()
+    CpuSetupBenchmark();
+  }
+
+  void setupCpu65C02()
+  {
+    writeMain(0x0300, {
+      0xA2, 0x00,         // LDX #$00
+      0x64, 0x10,         // STZ $10
+      0x1A,               // INC A
+      0x92, 0x12,         // STA ($12)
+      0xB2, 0x12,         // LDA ($12)
+      0xDA,               // PHX
+      0x7A,               // PLY
+      0x04, 0x10,         // TSB $10
+      0x14, 0x10,         // TRB $10
+      0x89, 0x01,         // BIT #$01
+      0x3C, 0x00, 0x10,   // BIT $1000,X
+      0xE8,               // INX
+      0x80, 0xEB,         // BRA $0302
+    });
+    writeMain(0x0012, {0x00, 0x10});
+    regs.pc = 0x0300;
+  }
+
+  void setupBankSwitch()
+  {
+    const std::vector<BYTE> code = {
+      0x8D, 0x03, 0xC0,   // STA $C003 : RAMRD on
+      0x8D, 0x05, 0xC0,   // STA $C005 : RAMWRT on
+      0x8D, 0x09, 0xC0,   // STA $C009 : ALTZP on
+      0xAD, 0x8B, 0xC0,   // LDA $C08B : LC bank 1, read RAM
+      0xAD, 0x8B, 0xC0,   // LDA $C08B : ... write enabled
+      0xEE, 0x00, 0xD0,   // INC $D000
+      0xEE, 0x00, 0x20,   // INC $2000 : aux
+      0x8D, 0x02, 0xC0,   // STA $C002 : RAMRD off
+      0x8D, 0x04, 0xC0,   // STA $C004 : RAMWRT off
+      0x8D, 0x08, 0xC0,   // STA $C008 : ALTZP off
+      0xAD, 0x82, 0xC0,   // LDA $C082 : LC read ROM, write protected
+      0xEE, 0x00, 0x20,   // INC $2000 : main
+      0x4C, 0x00, 0x03,   // JMP $0300
+    };
+    // RAMRD also switches where the code is fetched from
+    memcpy(MemGetMainPtr(0x0300), code.data(), code.size());
+    memcpy(MemGetAuxPtr(0x0300), code.data(), code.size());
+    regs.pc = 0x0300;
+  }
+
+  void setupHgrPageFlip()
+  {
+    writeMain(0x0300, {
+      0xAD, 0x50, 0xC0,   // LDA $C050 : graphics
+      0xAD, 0x57, 0xC0,   // LDA $C057 : hires
+      0xAD, 0x52, 0xC0,   // LDA $C052 : full screen
+      0xA9, 0x00,         // LDA #$00
+      0x85, 0x06,         // STA $06
+      0xAD, 0x55, 0xC0,   // $030D: LDA $C055 : show page 2
+      0xA2, 0x20,         // LDX #$20
+      0x20, 0x30, 0x03,   // JSR $0330 : draw page 1
+      0xAD, 0x54, 0xC0,   // LDA $C054 : show page 1
+      0xA2, 0x40,         // LDX #$40
+      0x20, 0x30, 0x03,   // JSR $0330 : draw page 2
+      0xE6, 0x08,         // INC $08 : next pattern
+      0x4C, 0x0D, 0x03,   // JMP $030D
+    });
+    writeMain(0x0330, {
+      0x86, 0x07,         // STX $07
+      0xA0, 0x00,         // LDY #$00
+      0xA5, 0x08,         // LDA $08
+      0xA2, 0x20,         // LDX #$20 : 8K
+      0x91, 0x06,         // $0338: STA ($06),Y
+      0xC8,               // INY
+      0xD0, 0xFB,         // BNE $0338
+      0xE6, 0x07,         // INC $07
+      0xCA,               // DEX
+      0xD0, 0xF6,         // BNE $0338
+      0x60,               // RTS
+    });
+    regs.pc = 0x0300;
+  }
+
+  void setupDisk2()
+  {
+    // read 4096 nibbles, then step the head by a half track, sweeping between track 0 and 34
+    writeMain(0x0300, {
+      0xAD, 0xE9, 0xC0,   // LDA $C0E9 : motor on
+      0xAD, 0xEA, 0xC0,   // LDA $C0EA : drive 1
+      0xAD, 0xEE, 0xC0,   // LDA $C0EE : read mode
+      0xA0, 0x00,         // $0309: LDY #$00
+      0xA2, 0x10,         // LDX #$10
+      0xAD, 0xEC, 0xC0,   // $030D: LDA $C0EC : data latch
+      0x10, 0xFB,         // BPL $030D
+      0x88,               // DEY
+      0xD0, 0xF8,         // BNE $030D
+      0xCA,               // DEX
+      0xD0, 0xF5,         // BNE $030D
+      0xA5, 0x07,         // LDA $07 : phase
+      0x18,               // CLC
+      0x65, 0x08,         // ADC $08 : +1 or -1 (mod 4)
+      0x29, 0x03,         // AND #$03
+      0x85, 0x07,         // STA $07
+      0x0A,               // ASL A
+      0xAA,               // TAX
+      0xBD, 0xE1, 0xC0,   // LDA $C0E1,X : next phase on
+      0xA5, 0x08,         // LDA $08
+      0x49, 0x02,         // EOR #$02
+      0x18,               // CLC
+      0x65, 0x07,         // ADC $07
+      0x29, 0x03,         // AND #$03
+      0x0A,               // ASL A
+      0xAA,               // TAX
+      0xBD, 0xE0, 0xC0,   // LDA $C0E0,X : previous phase off
+      0xC6, 0x09,         // DEC $09
+      0xD0, 0x0A,         // BNE $0342
+      0xA9, 0x44,         // LDA #68 : half tracks
+      0x85, 0x09,         // STA $09
+      0xA5, 0x08,         // LDA $08
+      0x49, 0x02,         // EOR #$02 : reverse
+      0x85, 0x08,         // STA $08
+      0x4C, 0x09, 0x03,   // $0342: JMP $0309
+    });
+    writeMain(0x0007, {0x00, 0x01, 0x44});
+    regs.pc = 0x0300;
+  }
+
+  void setupMockingboard()
+  {
+    // 6522 #1 TIMER1 free running, each IRQ writes 3 AY8913 registers
+    writeMain(0x0300, {
+      0x78,               // SEI
+      0xA9, 0xFF,         // LDA #$FF
+      0x8D, 0x03, 0xC4,   // STA $C403 : DDRA
+      0xA9, 0x07,         // LDA #$07
+      0x8D, 0x02, 0xC4,   // STA $C402 : DDRB
+      0xA9, 0x40,         // LDA #$40
+      0x8D, 0x0B, 0xC4,   // STA $C40B : ACR = free running
+      0xA9, 0xC0,         // LDA #$C0
+      0x8D, 0x0E, 0xC4,   // STA $C40E : IER = TIMER1
+      0xA9, 0x00,         // LDA #$00
+      0x8D, 0x04, 0xC4,   // STA $C404
+      0xA9, 0x02,         // LDA #$02
+      0x8D, 0x05, 0xC4,   // STA $C405 : TIMER1 = $0200
+      0xA9, 0x80,         // LDA #$80
+      0x8D, 0xFE, 0x03,   // STA $03FE
+      0xA9, 0x03,         // LDA #$03
+      0x8D, 0xFF, 0x03,   // STA $03FF : IRQ vector = $0380
+      0x58,               // CLI
+      0x4C, 0x2A, 0x03,   // $032A: JMP $032A
+    });
+    writeMain(0x0380, {
+      0xAD, 0x04, 0xC4,   // LDA $C404 : clear TIMER1 IRQ
+      0xE6, 0x06,         // INC $06
+      0xA2, 0x07,         // LDX #$07
+      0xA9, 0x3E,         // LDA #$3E
+      0x20, 0xA0, 0x03,   // JSR $03A0 : mixer = tone A
+      0xA2, 0x08,         // LDX #$08
+      0xA9, 0x0F,         // LDA #$0F
+      0x20, 0xA0, 0x03,   // JSR $03A0 : volume A
+      0xA2, 0x00,         // LDX #$00
+      0xA5, 0x06,         // LDA $06
+      0x20, 0xA0, 0x03,   // JSR $03A0 : period A
+      0xA5, 0x45,         // LDA $45 : saved by the ROM's IRQ handler
+      0x40,               // RTI
+    });
+    writeMain(0x03A0, {
+      0x8E, 0x01, 0xC4,   // STX $C401 : ORA = register
+      0xA0, 0x07,         // LDY #$07
+      0x8C, 0x00, 0xC4,   // STY $C400 : latch address
+      0xA0, 0x04,         // LDY #$04
+      0x8C, 0x00, 0xC4,   // STY $C400 : inactive
+      0x8D, 0x01, 0xC4,   // STA $C401 : ORA = value
+      0xA0, 0x06,         // LDY #$06
+      0x8C, 0x00, 0xC4,   // STY $C400 : write
+      0xA0, 0x04,         // LDY #$04
+      0x8C, 0x00, 0xC4,   // STY $C400 : inactive
+      0x60,               // RTS
+    });
+    regs.pc = 0x0300;
+  }
+
+  const Workload ourWorkloads[] = {
+    {"cpu6502", "6502 opcode mix (CpuSetupBenchmark)", A2TYPE_APPLE2PLUS, CT_Empty, false, false, setupCpu6502},
+    {"cpu65c02", "65C02-only opcodes and (zp) addressing", A2TYPE_APPLE2EENHANCED, CT_Empty, false, false, setupCpu65C02},
+    {"bankswitch", "RAMRD/RAMWRT/ALTZP and language card switching", A2TYPE_APPLE2EENHANCED, CT_Empty, false, false, setupBankSwitch},
+    {"hgr", "HGR page flip, redrawing 8K per page (NTSC video on)", A2TYPE_APPLE2EENHANCED, CT_Empty, true, false, setupHgrPageFlip},
+    {"disk2", "Disk II nibble reading, sweeping tracks 0-34", A2TYPE_APPLE2EENHANCED, CT_Empty, false, true, setupDisk2},
+    {"mockingboard", "6522 TIMER1 IRQs writing AY8913 registers (no audio device)", A2TYPE_APPLE2EENHANCED, CT_MockingboardC, false, false, setupMockingboard},
+  };
+
+  // a 140K .dsk of pseudo random data: every run reads the same nibbles
+  std::string createDiskImage()
+  {
+    char filename[] = "/tmp/applewin-bench-XXXXXX.dsk";
+    const int fd = mkstemps(filename, 4);
+    if (fd < 0)
+    {
+      throw std::runtime_error("Benchmark: cannot create disk image");
+    }
+
+    std::vector<BYTE> image(35 * 16 * 256);
+    uint32_t seed = 0x12345678;
+    for (BYTE & b : image)
+    {
+      seed = seed * 1664525 + 1013904223;
+      b = seed >> 24;
+    }
+
+    const bool ok = write(fd, image.data(), image.size()) == ssize_t(image.size());
+    close(fd);
+    if (!ok)
+    {
+      unlink(filename);
+      throw std::runtime_error("Benchmark: cannot write disk image");
+    }
+    return filename;
+  }
+
+  std::shared_ptr<Registry> createRegistry(const Workload & workload)
+  {
+    const std::shared_ptr<common2::PTreeRegistry> registry = std::make_shared<common2::PTreeRegistry>();
+    registry->putDWord(REG_CONFIG, REGVALUE_APPLE2_TYPE, workload.model);
+    registry->putDWord(REG_CONFIG, REGVALUE_ENHANCE_DISK_SPEED, 0);
+
+    for (UINT slot = SLOT1; slot <= SLOT7; ++slot)
+    {
+      SS_CARDTYPE card = CT_Empty;
+      if (slot == SLOT4)
+        card = workload.slot4;
+      else if (slot == SLOT6)
+        card = CT_Disk2;
+      registry->putDWord(RegGetConfigSlotSection(slot), REGVALUE_CARD_TYPE, card);
+    }
+    return registry;
+  }
+
+  Result runWorkload(const common2::EmulatorOptions & options, const Workload & workload, const std::string & diskImage)
+  {
+    common2::EmulatorOptions workloadOptions;
+    workloadOptions.autoBoot = true;
+    workloadOptions.noAudio = true;
+    workloadOptions.noVideoUpdate = !workload.videoUpdate;
+    workloadOptions.memclear = options.memclear;
+    if (workload.disk)
+    {
+      workloadOptions.disk1 = diskImage;
+    }
+
+    const RegistryContext registryContext(createRegistry(workload));
+    const std::shared_ptr<common2::HeadlessFrame> frame = std::make_shared<common2::HeadlessFrame>(workloadOptions);
+    const std::shared_ptr<Paddle> paddle = std::make_shared<Paddle>();
+    const common2::CommonInitialisation init(frame, paddle, workloadOptions);
+
+    if (workload.disk && (GetCardMgr().QuerySlot(SLOT6) != CT_Disk2 ||
+      dynamic_cast<Disk2InterfaceCard &>(GetCardMgr().GetRef(SLOT6)).IsDriveEmpty(DRIVE_1)))
+    {
+      throw std::runtime_error("Benchmark: cannot insert disk image");
+    }
+
+    workload.setup();
+
+#ifdef LOG_PERF_TIMINGS
+    g_timeCpu = g_timeVideo = g_timeMB_Timer = g_timeMB_NoTimer = g_timeSpeaker = 0;
+#endif
+
+    const uint64_t startCycles = g_nCumulativeCycles;
+#ifdef LOG_PERF_TIMINGS
+    const uint64_t startInstructions = g_nCumulativeInstructions;
+#endif
+    const auto start = std::chrono::steady_clock::now();
+
+    frame->ExecuteCycles(options.benchCycles);
+
+    const auto end = std::chrono::steady_clock::now();
+
+    Result result;
+    result.cycles = g_nCumulativeCycles - startCycles;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+
+#ifdef LOG_PERF_TIMINGS
+    result.instructions = g_nCumulativeInstructions - startInstructions;
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    const double tick = 1.0 / frequency.QuadPart;
+    // same breakdown as LogPerfTimings()
+    result.cpu = (g_timeCpu - g_timeVideo - g_timeMB_Timer) * tick;
+    result.video = g_timeVideo * tick;
+    result.mockingboard = (g_timeMB_Timer + g_timeMB_NoTimer) * tick;
+    result.speaker = g_timeSpeaker * tick;
+#endif
+
+    return result;
+  }
+
+  void writeResult(std::ostream & output, const Workload & workload, const Result & result)
+  {
+    const double mhz = result.seconds > 0.0 ? result.cycles / result.seconds / 1.0e6 : 0.0;
+
+    output << "    {\n"
+           << "      \"name\": \"" << workload.name << "\",\n"
+           << "      \"description\": \"" << workload.description << "\",\n"
+           << "      \"cycles\": " << result.cycles << ",\n"
+           << std::fixed << std::setprecision(6)
+           << "      \"seconds\": " << result.seconds << ",\n"
+           << std::setprecision(3)
+           << "      \"mhz\": " << mhz;
+#ifdef LOG_PERF_TIMINGS
+    const double nsPerInstruction = result.instructions ? result.seconds * 1.0e9 / result.instructions : 0.0;
+    output << ",\n"
+           << "      \"instructions\": " << result.instructions << ",\n"
+           << "      \"ns_per_instruction\": " << nsPerInstruction;
+
+    const double other = result.seconds - result.cpu - result.video - result.mockingboard - result.speaker;
+    output << ",\n"
+           << std::setprecision(6)
+           << "      \"subsystems\": {"
+           << "\"cpu\": " << result.cpu << ", "
+           << "\"video\": " << result.video << ", "
+           << "\"mockingboard\": " << result.mockingboard << ", "
+           << "\"speaker\": " << result.speaker << ", "
+           << "\"other\": " << other << "}";
+#endif
+    output << "\n    }";
+  }
+
+}
+
+namespace common2
+{
+
+  int runBenchSuite(const EmulatorOptions & options)
+  {
+    std::ofstream file;
+    if (!options.benchOutput.empty())
+    {
+      file.open(options.benchOutput);
+      if (!file)
+      {
+        throw std::runtime_error("Cannot open benchmark output: " + options.benchOutput);
+      }
+    }
+    std::ostream & output = options.benchOutput.empty() ? std::cout : file;
+
+    const std::string diskImage = createDiskImage();
+
+    std::vector<Result> results;
+    try
+    {
+      for (const Workload & workload : ourWorkloads)
+      {
+        std::cerr << "Benchmark: " << workload.name << std::endl;
+        results.push_back(runWorkload(options, workload, diskImage));
+      }
+    }
+    catch (const std::exception &)
+    {
+      unlink(diskImage.c_str());
+      throw;
+    }
+    unlink(diskImage.c_str());
+
+    output << "{\n"
+           << "  \"version\": \"" << getVersion() << "\",\n"
+           << "  \"cycles_per_workload\": " << options.benchCycles << ",\n"
+           << "  \"workloads\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      writeResult(output, ourWorkloads[i], results[i]);
+      output << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    output << "  ]\n"
+           << "}\n";
+
+    return 0;
+  }
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace common2
+{
+
+  struct EmulatorOptions;
+
+  // run a fixed set of synthetic workloads for options.benchCycles each
+  // and write the results as JSON (emulated MHz and, if built with
+  // -DLOG_PERF_TIMINGS=ON, ns/instruction and the time spent in each subsystem)
+  //
+  // every workload starts from a fresh machine and an in-memory registry
+  // so the numbers do not depend on the user's configuration
+  int runBenchSuite(const EmulatorOptions & options);
+
+}
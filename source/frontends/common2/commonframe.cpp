@@ -7,6 +7,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <thread>
+#include <algorithm>
 
 #include "CardManager.h"
 #include "Core.h"
@@ -25,13 +26,25 @@ namespace common2
     , mySpeed(options.fixedSpeed)
     , mySynchroniseWithTimer(options.syncWithTimer)
     , myAllowVideoUpdate(!options.noVideoUpdate)
+    , myVideoRenderSkip(options.noRender)
+    , myRewindFrameMicros(0)
   {
     myLastSync = std::chrono::steady_clock::now();
+    if (options.rewindSize)
+    {
+      myRewind = std::make_unique<Rewind>(options.rewindSize << 20);
+    }
+    if (!options.captureFile.empty())
+    {
+      myFrameCapture = std::make_unique<FrameCapture>(options.captureFile, options.captureQueueLength, options.captureKeyFrameInterval, options.captureDropFrames);
+    }
+    SetFullSpeedRenderThread(options.fullSpeedRenderThread);
   }
 
   void CommonFrame::Begin()
   {
     LinuxFrame::Begin();
+    NTSC_SetVideoRenderSkip(myVideoRenderSkip);
     ResetSpeed();
     ResetHardware();
   }
@@ -96,6 +109,8 @@ namespace common2
       else
       {
         // leaving full speed
+        // the video scanner runs on this thread again
+        VideoWaitForRenderThread();
         GetCardMgr().GetMockingboardCardMgr().MuteControl(false);
         ResetSpeed();
       }
@@ -123,6 +138,11 @@ namespace common2
       case MODE_RUNNING:
         {
           ExecuteInRunningMode(microseconds);
+          if (myRewind)
+          {
+            myRewind->push();
+            myRewindFrameMicros = microseconds;
+          }
           break;
         }
       case MODE_STEPPING:
@@ -135,9 +155,24 @@ namespace common2
     };
   }
 
+  void CommonFrame::ExecuteCycles(const uint64_t cycles)
+  {
+    // 1 video frame at a time, so DWORD cannot overflow
+    const uint64_t cyclesPerFrame = NTSC_GetCyclesPerFrame();
+
+    uint64_t remaining = cycles;
+    while (remaining > 0 && g_nAppMode == MODE_RUNNING)
+    {
+      const DWORD thisCycles = std::min(cyclesPerFrame, remaining);
+      Execute(thisCycles);
+      remaining -= thisCycles;
+    }
+  }
+
   void CommonFrame::ExecuteInRunningMode(const int64_t microseconds)
   {
-    SetFullSpeed(CanDoFullSpeed());
+    // full speed does not render the video frames, which the capture needs
+    SetFullSpeed(!myFrameCapture && CanDoFullSpeed());
     const DWORD cyclesToExecute = mySpeed.getCyclesTillNext(microseconds);  // this checks g_bFullSpeed
     Execute(cyclesToExecute);
   }
@@ -160,16 +195,24 @@ namespace common2
     const bool bVideoUpdate = myAllowVideoUpdate && !g_bFullSpeed;
     const UINT dwClksPerFrame = NTSC_GetCyclesPerFrame();
 
-    // do it in the same batches as AppleWin (1 ms)
-    const DWORD fExecutionPeriodClks = g_fCurrentCLK6502 * (1.0 / 1000.0);  // 1 ms
-
     DWORD totalCyclesExecuted = 0;
     // check at the end because we want to always execute at least 1 cycle even for "0"
     do
     {
       _ASSERT(cyclesToExecute >= totalCyclesExecuted);
-      const DWORD thisCyclesToExecute = std::min(fExecutionPeriodClks, cyclesToExecute - totalCyclesExecuted);
-      const DWORD executedCycles = CpuExecute(thisCyclesToExecute, bVideoUpdate);
+      // AppleWin runs in 1 ms batches: here we run straight to the first cycle a card or the speaker needs servicing
+      // with nothing to service (headless, full speed, no sound) this is the whole request
+      // an I/O access which arms a card's Update() (eg. disk motor-off) ends the batch early, so it's serviced on time
+      // when capturing, a batch also ends at the start of VBlank, when the framebuffer holds the whole frame
+      DWORD cyclesUntilUpdate = std::min(GetCardMgr().GetCyclesUntilUpdate(), SpkrGetCyclesUntilUpdate());
+      const bool capture = myFrameCapture && bVideoUpdate && !myFramebuffer.empty();
+      const UINT cyclesUntilVBlank = capture ? NTSC_GetCyclesUntilVBlank(0) : 0;
+      if (capture)
+      {
+        cyclesUntilUpdate = std::min<DWORD>(cyclesUntilUpdate, cyclesUntilVBlank);
+      }
+      const DWORD thisCyclesToExecute = std::min(cyclesUntilUpdate, cyclesToExecute - totalCyclesExecuted);
+      const DWORD executedCycles = CpuExecute(thisCyclesToExecute, bVideoUpdate, true);
       totalCyclesExecuted += executedCycles;
 
       GetCardMgr().Update(executedCycles);
@@ -177,6 +220,14 @@ namespace common2
 
       g_dwCyclesThisFrame = (g_dwCyclesThisFrame + executedCycles) % dwClksPerFrame;
 
+      if (capture && executedCycles >= cyclesUntilVBlank)
+      {
+        // VBlanks are a frame's worth of cycles apart: this numbers the emulated frames
+        const uint64_t cycleVBlank = g_nCumulativeCycles - (executedCycles - cyclesUntilVBlank);
+        Video & video = GetVideo();
+        myFrameCapture->push(myFramebuffer.data(), video.GetFrameBufferWidth(), video.GetFrameBufferHeight(), cycleVBlank / dwClksPerFrame);
+      }
+
     } while (totalCyclesExecuted < cyclesToExecute);
   }
 
@@ -234,6 +285,24 @@ namespace common2
     ResetHardware();
   }
 
+  bool CommonFrame::RewindHistory(const int64_t microseconds)
+  {
+    if (!myRewind || myRewindFrameMicros <= 0)
+    {
+      return false;
+    }
+
+    const size_t frames = std::max<int64_t>(1, microseconds / myRewindFrameMicros);
+    if (!myRewind->pop(frames))
+    {
+      return false;
+    }
+
+    ResetSpeed();
+    ResetHardware();
+    return true;
+  }
+
   void CommonFrame::SyncVideoPresentScreen(const int64_t microseconds)
   {
     if (mySynchroniseWithTimer)
@@ -6,6 +6,9 @@
 #include "Configuration/Config.h"
 
 #include "frontends/common2/speed.h"
+#include "frontends/common2/rewind.h"
+#include "frontends/common2/framecapture.h"
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -26,6 +29,9 @@ namespace common2
 
     void ExecuteOneFrame(const int64_t microseconds);
 
+    // run a fixed number of cycles as fast as possible (no speed control)
+    void ExecuteCycles(const uint64_t cycles);
+
     // this function will emulate GL vert sync if necessary
     // it acts as a syncronisation point (sa2 (in qemu) and applen)
     void SyncVideoPresentScreen(const int64_t microseconds);
@@ -39,6 +45,9 @@ namespace common2
 
     void LoadSnapshot() override;
 
+    // go back (about) this much emulated time, if rewind is enabled
+    bool RewindHistory(const int64_t microseconds);
+
   protected:
     virtual std::string getResourcePath(const std::string & filename) = 0;
 
@@ -61,6 +70,10 @@ namespace common2
 
   private:
     const bool myAllowVideoUpdate;
+    const bool myVideoRenderSkip;
+    std::unique_ptr<Rewind> myRewind;  // 1 snapshot per frame
+    int64_t myRewindFrameMicros;
+    std::unique_ptr<FrameCapture> myFrameCapture;
     CConfigNeedingRestart myHardwareConfig;
   };
 
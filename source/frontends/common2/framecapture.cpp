@@ -0,0 +1,308 @@
+#include "StdAfx.h"
+#include "frontends/common2/framecapture.h"
+
+#include "Log.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace common2
+{
+
+  const char FrameCapture::ourMagic[8] = {'A', 'W', 'C', 'A', 'P', 'T', '0', '1'};
+  const char FrameCapture::ourIndexMagic[8] = {'A', 'W', 'C', 'A', 'P', 'I', 'D', 'X'};
+
+  FrameCapture::FrameCapture(const std::string & filename, const size_t queueLength, const size_t keyFrameInterval, const bool dropWhenFull)
+    : myQueueLength(std::max<size_t>(1, queueLength))
+    , myKeyFrameInterval(std::max<size_t>(1, keyFrameInterval))
+    , myDropWhenFull(dropWhenFull)
+    , myOffset(0)
+    , myFailed(false)
+    , myWritten(0)
+    , myDropped(0)
+    , myQuit(false)
+    , myPreviousWidth(0)
+    , myPreviousHeight(0)
+  {
+    myFile = fopen(filename.c_str(), "wb");
+    if (!myFile)
+    {
+      throw std::runtime_error("Cannot open capture file: " + filename);
+    }
+
+    writeBytes(ourMagic, sizeof(ourMagic));
+    myThread = std::thread(&FrameCapture::run, this);
+  }
+
+  FrameCapture::~FrameCapture()
+  {
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myQuit = true;
+    }
+    myCondition.notify_one();
+    myThread.join();
+
+    writeIndex();
+    if (fclose(myFile) != 0)
+    {
+      myFailed = true;
+    }
+
+    LogFileOutput("FrameCapture: %" SIZE_T_FMT " frames written, %" SIZE_T_FMT " dropped%s\n",
+      myWritten, myDropped, myFailed ? " (write error)" : "");
+  }
+
+  void FrameCapture::push(const uint8_t * data, const size_t width, const size_t height, const uint64_t number)
+  {
+    const size_t size = width * height * sizeof(uint32_t);
+
+    std::vector<uint8_t> pixels;
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+      if (myDropWhenFull && myQueue.size() >= myQueueLength)
+      {
+        ++myDropped;
+        return;
+      }
+      // the emulator waits for the writer, so that no frame is lost
+      mySpace.wait(lock, [this] { return myQueue.size() < myQueueLength; });
+      if (!myFreeBuffers.empty())
+      {
+        pixels.swap(myFreeBuffers.back());
+        myFreeBuffers.pop_back();
+      }
+    }
+
+    // the copy happens outside the lock, the writer is never held up by it
+    pixels.assign(data, data + size);
+
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myQueue.push_back({number, uint32_t(width), uint32_t(height), std::move(pixels)});
+    }
+    myCondition.notify_one();
+  }
+
+  size_t FrameCapture::getNumberOfFramesWritten() const
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    return myWritten;
+  }
+
+  size_t FrameCapture::getNumberOfFramesDropped() const
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    return myDropped;
+  }
+
+  void FrameCapture::run()
+  {
+    std::unique_lock<std::mutex> lock(myMutex);
+    while (true)
+    {
+      myCondition.wait(lock, [this] { return myQuit || !myQueue.empty(); });
+      if (myQueue.empty())
+      {
+        // only quit once the queue is drained
+        break;
+      }
+
+      Frame frame = std::move(myQueue.front());
+      myQueue.pop_front();
+
+      lock.unlock();
+      mySpace.notify_one();
+      writeFrame(frame);
+      lock.lock();
+
+      ++myWritten;
+      myFreeBuffers.push_back(std::move(frame.pixels));
+    }
+  }
+
+  void FrameCapture::writeFrame(Frame & frame)
+  {
+    const std::vector<uint8_t> & pixels = frame.pixels;
+
+    uint32_t type = KeyFrame;
+    const uint8_t * source = pixels.data();
+    if (myIndex.size() % myKeyFrameInterval != 0 && frame.width == myPreviousWidth && frame.height == myPreviousHeight)
+    {
+      // mostly zeros: only the pixels which changed are left
+      type = DeltaFrame;
+      myDelta.resize(pixels.size());
+      for (size_t i = 0; i < pixels.size(); ++i)
+      {
+        myDelta[i] = pixels[i] ^ myPrevious[i];
+      }
+      source = myDelta.data();
+    }
+
+    uLongf compressedSize = compressBound(pixels.size());
+    myCompressed.resize(compressedSize);
+    if (compress2(myCompressed.data(), &compressedSize, source, pixels.size(), Z_BEST_SPEED) != Z_OK)
+    {
+      myFailed = true;
+      return;
+    }
+
+    myIndex.push_back({myOffset, frame.number, type});
+
+    const uint32_t header[4] = {frame.width, frame.height, type, uint32_t(compressedSize)};
+    writeBytes(&frame.number, sizeof(frame.number));
+    writeBytes(header, sizeof(header));
+    writeBytes(myCompressed.data(), compressedSize);
+
+    myPrevious.assign(pixels.begin(), pixels.end());
+    myPreviousWidth = frame.width;
+    myPreviousHeight = frame.height;
+  }
+
+  void FrameCapture::writeIndex()
+  {
+    const uint64_t indexOffset = myOffset;
+    for (const IndexEntry & entry : myIndex)
+    {
+      writeBytes(&entry.offset, sizeof(entry.offset));
+      writeBytes(&entry.number, sizeof(entry.number));
+      writeBytes(&entry.type, sizeof(entry.type));
+    }
+
+    const uint64_t count = myIndex.size();
+    writeBytes(&indexOffset, sizeof(indexOffset));
+    writeBytes(&count, sizeof(count));
+    writeBytes(ourIndexMagic, sizeof(ourIndexMagic));
+  }
+
+  void FrameCapture::writeBytes(const void * data, const size_t size)
+  {
+    if (fwrite(data, 1, size, myFile) != size)
+    {
+      myFailed = true;
+    }
+    myOffset += size;
+  }
+
+  FrameCaptureReader::FrameCaptureReader(const std::string & filename)
+  {
+    myFile = fopen(filename.c_str(), "rb");
+    if (!myFile)
+    {
+      throw std::runtime_error("Cannot open capture file: " + filename);
+    }
+
+    char magic[sizeof(FrameCapture::ourMagic)];
+    uint64_t indexOffset = 0;
+    uint64_t count = 0;
+    char indexMagic[sizeof(FrameCapture::ourIndexMagic)];
+
+    const long footerSize = sizeof(indexOffset) + sizeof(count) + sizeof(indexMagic);
+    const bool ok = readBytes(magic, sizeof(magic)) && memcmp(magic, FrameCapture::ourMagic, sizeof(magic)) == 0
+      && fseeko(myFile, -footerSize, SEEK_END) == 0
+      && readBytes(&indexOffset, sizeof(indexOffset)) && readBytes(&count, sizeof(count)) && readBytes(indexMagic, sizeof(indexMagic))
+      && memcmp(indexMagic, FrameCapture::ourIndexMagic, sizeof(indexMagic)) == 0
+      && fseeko(myFile, indexOffset, SEEK_SET) == 0;
+
+    for (uint64_t i = 0; ok && i < count; ++i)
+    {
+      IndexEntry entry;
+      uint64_t number;
+      if (!readBytes(&entry.offset, sizeof(entry.offset)) || !readBytes(&number, sizeof(number)) || !readBytes(&entry.type, sizeof(entry.type)))
+      {
+        break;
+      }
+      myIndex.push_back(entry);
+    }
+
+    if (!ok || myIndex.size() != count)
+    {
+      fclose(myFile);
+      throw std::runtime_error("Not a complete capture file: " + filename);
+    }
+  }
+
+  FrameCaptureReader::~FrameCaptureReader()
+  {
+    fclose(myFile);
+  }
+
+  size_t FrameCaptureReader::getNumberOfRecords() const
+  {
+    return myIndex.size();
+  }
+
+  bool FrameCaptureReader::read(const size_t record, FrameCapture::Frame & frame)
+  {
+    if (record >= myIndex.size())
+    {
+      return false;
+    }
+
+    size_t key = record;
+    while (key > 0 && myIndex[key].type != FrameCapture::KeyFrame)
+    {
+      --key;
+    }
+
+    for (size_t i = key; i <= record; ++i)
+    {
+      if (!readRecord(myIndex[i], frame))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool FrameCaptureReader::readRecord(const IndexEntry & entry, FrameCapture::Frame & frame)
+  {
+    uint64_t number;
+    uint32_t header[4];  // width, height, type, compressed size
+    if (fseeko(myFile, entry.offset, SEEK_SET) != 0 || !readBytes(&number, sizeof(number)) || !readBytes(header, sizeof(header)))
+    {
+      return false;
+    }
+
+    const uint32_t type = header[2];
+    uLongf size = uLongf(header[0]) * header[1] * sizeof(uint32_t);
+    if (type != entry.type || (type == FrameCapture::DeltaFrame && (header[0] != frame.width || header[1] != frame.height)))
+    {
+      return false;
+    }
+
+    myCompressed.resize(header[3]);
+    myDecompressed.resize(size);
+    if (!readBytes(myCompressed.data(), myCompressed.size())
+      || uncompress(myDecompressed.data(), &size, myCompressed.data(), myCompressed.size()) != Z_OK || size != myDecompressed.size())
+    {
+      return false;
+    }
+
+    if (type == FrameCapture::KeyFrame)
+    {
+      frame.pixels.assign(myDecompressed.begin(), myDecompressed.end());
+    }
+    else
+    {
+      for (size_t i = 0; i < frame.pixels.size(); ++i)
+      {
+        frame.pixels[i] ^= myDecompressed[i];
+      }
+    }
+
+    frame.number = number;
+    frame.width = header[0];
+    frame.height = header[1];
+    return true;
+  }
+
+  bool FrameCaptureReader::readBytes(void * data, const size_t size)
+  {
+    return fread(data, 1, size, myFile) == size;
+  }
+
+}
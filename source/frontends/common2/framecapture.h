@@ -0,0 +1,129 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common2
+{
+
+  // lossless capture of every emulated video frame to a file
+  //
+  // the emulator copies the framebuffer into a bounded queue at the end of each emulated frame
+  // and waits for room if the writer falls behind (or, if dropWhenFull, drops the frame)
+  // a background thread xors each frame with the previous one, deflates it (zlib) and appends it
+  //
+  // file layout (native endianness)
+  //   header: ourMagic
+  //   records: [frame number (u64), width (u32), height (u32), type (u32), compressed size (u32), zlib data]
+  //   index: [offset (u64), frame number (u64), type (u32)] for each record
+  //   footer: [index offset (u64), number of records (u64), ourIndexMagic]
+  // a record of type key holds the frame itself, a delta one the xor with the previous record
+  // the frame number is the emulated frame's (since power on): a gap is a frame which was not rendered or dropped
+  class FrameCapture
+  {
+  public:
+    enum RecordType : uint32_t { KeyFrame = 0, DeltaFrame = 1 };
+
+    struct Frame
+    {
+      uint64_t number;
+      uint32_t width;
+      uint32_t height;
+      std::vector<uint8_t> pixels;
+    };
+
+    static const char ourMagic[8];
+    static const char ourIndexMagic[8];
+
+    // queueLength: frames waiting to be compressed before push() waits (or drops)
+    // keyFrameInterval: records between 2 key frames (seek granularity)
+    FrameCapture(const std::string & filename, const size_t queueLength, const size_t keyFrameInterval, const bool dropWhenFull);
+
+    // writes the queued frames and the index
+    ~FrameCapture();
+
+    // copy the frame (4 bytes per pixel) to the queue
+    void push(const uint8_t * data, const size_t width, const size_t height, const uint64_t number);
+
+    size_t getNumberOfFramesWritten() const;
+    size_t getNumberOfFramesDropped() const;
+
+  private:
+    struct IndexEntry
+    {
+      uint64_t offset;
+      uint64_t number;
+      uint32_t type;
+    };
+
+    void run();
+    void writeFrame(Frame & frame);
+    void writeIndex();
+    void writeBytes(const void * data, const size_t size);
+
+    const size_t myQueueLength;
+    const size_t myKeyFrameInterval;
+    const bool myDropWhenFull;
+
+    FILE * myFile;
+    uint64_t myOffset;
+    bool myFailed;
+
+    // shared, protected by myMutex
+    mutable std::mutex myMutex;
+    std::condition_variable myCondition;  // frames to write (or quit)
+    std::condition_variable mySpace;  // room in the queue
+    std::deque<Frame> myQueue;
+    std::vector<std::vector<uint8_t>> myFreeBuffers;  // recycled to avoid allocating on the emulator thread
+    size_t myWritten;
+    size_t myDropped;
+    bool myQuit;
+
+    // writer side
+    std::vector<uint8_t> myPrevious;
+    std::vector<uint8_t> myDelta;
+    std::vector<uint8_t> myCompressed;
+    std::vector<IndexEntry> myIndex;
+    uint32_t myPreviousWidth;
+    uint32_t myPreviousHeight;
+
+    std::thread myThread;
+  };
+
+  // decodes the records of a capture file
+  class FrameCaptureReader
+  {
+  public:
+    // throws if the file is not a (complete) capture
+    explicit FrameCaptureReader(const std::string & filename);
+    ~FrameCaptureReader();
+
+    size_t getNumberOfRecords() const;
+
+    // decodes the key frame before the record and the deltas up to it, false if the file is corrupt
+    bool read(const size_t record, FrameCapture::Frame & frame);
+
+  private:
+    struct IndexEntry
+    {
+      uint64_t offset;
+      uint32_t type;
+    };
+
+    bool readBytes(void * data, const size_t size);
+    bool readRecord(const IndexEntry & entry, FrameCapture::Frame & frame);
+
+    FILE * myFile;
+    std::vector<IndexEntry> myIndex;
+    std::vector<uint8_t> myCompressed;
+    std::vector<uint8_t> myDecompressed;
+  };
+
+}
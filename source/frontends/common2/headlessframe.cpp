@@ -0,0 +1,28 @@
+#include "StdAfx.h"
+#include "frontends/common2/headlessframe.h"
+
+#include "Log.h"
+
+#include <iostream>
+
+namespace common2
+{
+
+  HeadlessFrame::HeadlessFrame(const EmulatorOptions & options)
+    : GNUFrame(options)
+  {
+  }
+
+  void HeadlessFrame::VideoPresentScreen()
+  {
+    // nothing to present
+  }
+
+  int HeadlessFrame::FrameMessageBox(LPCSTR lpText, LPCSTR lpCaption, UINT uType)
+  {
+    LogFileOutput("MessageBox:\n%s\n%s\n\n", lpCaption, lpText);
+    std::cerr << lpCaption << ": " << lpText << std::endl;
+    return IDOK;
+  }
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "frontends/common2/gnuframe.h"
+
+namespace common2
+{
+
+  // a frame without any output: used when the emulator runs without a user
+  // e.g. in batch mode
+  class HeadlessFrame : public GNUFrame
+  {
+  public:
+    HeadlessFrame(const EmulatorOptions & options);
+
+    void VideoPresentScreen() override;
+    int FrameMessageBox(LPCSTR lpText, LPCSTR lpCaption, UINT uType) override;
+  };
+
+}
@@ -130,6 +130,7 @@ namespace common2
       ("paused", "Start paused")
       ("fixed-speed", "Fixed (non-adaptive) speed")
       ("headless", "Headless: disable video (freewheel)")
+      ("no-render", "Exact video timing, but do not render")
       ("audio-buffer", po::value<size_t>()->default_value(options.audioBuffer), "Audio buffer (ms)")
       ("benchmark,b", "Benchmark emulator")
       ("no-squaring", "Gamepad range is (already) a square")
@@ -145,6 +146,15 @@ namespace common2
       ;
     desc.add(audioDesc);
 
+    po::options_description captureDesc("Capture");
+    captureDesc.add_options()
+      ("capture", po::value<std::string>(), "Lossless capture of every video frame (zlib)")
+      ("capture-queue", po::value<size_t>()->default_value(options.captureQueueLength), "Frames waiting to be written before the emulator waits")
+      ("capture-key-interval", po::value<size_t>()->default_value(options.captureKeyFrameInterval), "Frames between 2 key frames")
+      ("capture-drop", "Drop frames (rather than wait) when the queue is full")
+      ;
+    desc.add(captureDesc);
+
     switch (type)
     {
     case OptionsType::sa2:
@@ -160,6 +170,9 @@ namespace common2
         ("game-controller", po::value<int>(), "SDL_GameControllerOpen")
         ("game-mapping-file", po::value<std::string>(), "SDL_GameControllerAddMappingsFromFile")
         ("audio-device", po::value<std::string>(), "Audio device name")
+        ("rewind", po::value<size_t>()->default_value(options.rewindSize), "Rewind history (MB, 0 = disabled)")
+        ("render-thread", "Render full speed video on a separate thread")
+        ("emulation-thread", "Run the emulator on a separate thread from the presentation")
         ;
       desc.add(sdlDesc);
       break;
@@ -172,6 +185,24 @@ namespace common2
         ("device-name", po::value<std::string>(), "Gamepad device name (for applen)")
         ;
       desc.add(applenDesc);
+
+      po::options_description batchDesc("Batch");
+      batchDesc.add_options()
+        ("batch", po::value<std::string>(), "Run each image listed in file (headless) and exit")
+        ("batch-cycles", po::value<uint64_t>()->default_value(options.batchCycles), "Cycles to execute per image")
+        ("batch-jobs", po::value<size_t>()->default_value(options.batchJobs), "Concurrent images (0 = number of cores)")
+        ("batch-output", po::value<std::string>(), "Batch results file (CSV)")
+        ("batch-stop-hash", po::value<std::string>(), "Stop each image when its video hash (hex) is reached")
+        ;
+      desc.add(batchDesc);
+
+      po::options_description benchDesc("Benchmark");
+      benchDesc.add_options()
+        ("bench-suite", "Run the synthetic workloads (headless) and exit")
+        ("bench-cycles", po::value<uint64_t>()->default_value(options.benchCycles), "Cycles to execute per workload")
+        ("bench-output", po::value<std::string>(), "Benchmark results file (JSON)")
+        ;
+      desc.add(benchDesc);
       break;
     }
     }
@@ -221,6 +252,7 @@ namespace common2
       options.autoBoot = vm.count("paused") == 0; 
       options.fixedSpeed = vm.count("fixed-speed") > 0;
       options.headless = vm.count("headless") > 0;
+      options.noRender = vm.count("no-render") > 0;
       setOption(vm, "audio-buffer", options.audioBuffer);
       options.benchmark = vm.count("benchmark") > 0;
       options.paddleSquaring = vm.count("no-squaring") == 0;
@@ -231,6 +263,12 @@ namespace common2
       setOption(vm, "wav-speaker", options.wavFileSpeaker);
       setOption(vm, "wav-mockingboard", options.wavFileMockingboard);
 
+      // Capture
+      setOption(vm, "capture", options.captureFile);
+      setOption(vm, "capture-queue", options.captureQueueLength);
+      setOption(vm, "capture-key-interval", options.captureKeyFrameInterval);
+      options.captureDropFrames = vm.count("capture-drop") > 0;
+
       switch (type)
       {
       case OptionsType::sa2:
@@ -250,12 +288,30 @@ namespace common2
         setOption(vm, "game-controller", options.gameControllerIndex);
         setOption(vm, "game-mapping-file", options.gameControllerMappingFile);
         setOption(vm, "audio-device", options.audioDeviceName);
+        setOption(vm, "rewind", options.rewindSize);
+        options.fullSpeedRenderThread = vm.count("render-thread") > 0;
+        options.emulationThread = vm.count("emulation-thread") > 0;
         break;
       }
       case OptionsType::applen:
       {
         options.noVideoUpdate = vm.count("no-video-update") > 0;
         setOption(vm, "device-name", options.paddleDeviceName);
+
+        setOption(vm, "batch", options.batchFile);
+        setOption(vm, "batch-cycles", options.batchCycles);
+        setOption(vm, "batch-jobs", options.batchJobs);
+        setOption(vm, "batch-output", options.batchOutput);
+
+        std::string stopHash;
+        if (setOption(vm, "batch-stop-hash", stopHash))
+        {
+          options.batchStopHash = std::stoull(stopHash, nullptr, 16);
+        }
+
+        options.benchSuite = vm.count("bench-suite") > 0;
+        setOption(vm, "bench-cycles", options.benchCycles);
+        setOption(vm, "bench-output", options.benchOutput);
         break;
       }
       }
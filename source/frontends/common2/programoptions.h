@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <cstdint>
 
 namespace common2
 {
@@ -36,6 +37,7 @@ namespace common2
     bool benchmark = false;
     bool headless = false;
     bool noVideoUpdate = false;  // only for applen
+    bool noRender = false;  // video scanner only, see NTSC_SetVideoRenderSkip()
 
     bool paddleSquaring = true;  // turn the x/y range to a square
     // on my PC it is something like
@@ -60,6 +62,9 @@ namespace common2
     std::optional<int> gameControllerIndex;
     std::string gameControllerMappingFile;
     std::string audioDeviceName;
+    size_t rewindSize = 0; // MB of snapshot deltas to keep for rewind (0 = disabled)
+    bool fullSpeedRenderThread = false; // render the full speed video frames on a separate thread
+    bool emulationThread = false; // run the emulator on a separate thread from the presentation
 
     std::string customRomF8;
     std::string customRom;
@@ -68,9 +73,24 @@ namespace common2
     std::string wavFileSpeaker;
     std::string wavFileMockingboard;
 
+    std::string captureFile;
+    size_t captureQueueLength = 16; // frames
+    size_t captureKeyFrameInterval = 60; // frames
+    bool captureDropFrames = false; // drop frames rather than wait for the writer
+
     std::vector<std::string> registryOptions;
 
     std::vector<std::string> natPortFwds;
+
+    std::string batchFile;  // list of images to run headless, one per line
+    std::string batchOutput;  // results, default to stdout
+    uint64_t batchCycles = 10000000; // about 10s of emulated time
+    size_t batchJobs = 0; // 0 = one per core
+    std::optional<uint64_t> batchStopHash; // stop an image as soon as Video::GetScreenHash() reaches it
+
+    bool benchSuite = false;  // run the synthetic workloads and exit
+    std::string benchOutput;  // JSON results, default to stdout
+    uint64_t benchCycles = 50000000; // per workload
   };
 
   enum class OptionsType { none, applen, sa2 };
@@ -0,0 +1,166 @@
+#include "StdAfx.h"
+#include "frontends/common2/rewind.h"
+
+#include "SaveState.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+  // granularity of the comparison: small enough to isolate single changed bytes
+  // large enough to keep the run headers negligible
+  const size_t ourBlockSize = 64;
+
+  void append(std::vector<uint8_t> & data, const uint32_t value)
+  {
+    const uint8_t * p = reinterpret_cast<const uint8_t *>(&value);
+    data.insert(data.end(), p, p + sizeof(value));
+  }
+
+  uint32_t read(const std::vector<uint8_t> & data, size_t & pos)
+  {
+    uint32_t value;
+    memcpy(&value, data.data() + pos, sizeof(value));
+    pos += sizeof(value);
+    return value;
+  }
+
+  bool isBlockEqual(const std::vector<uint8_t> & from, const std::vector<uint8_t> & to, const size_t offset, const size_t length)
+  {
+    return offset + length <= from.size() && memcmp(from.data() + offset, to.data() + offset, length) == 0;
+  }
+
+  // delta which turns "from" into "to"
+  // [size of "to"] followed by runs of [offset, length, bytes]
+  void makeDelta(const std::vector<uint8_t> & from, const std::vector<uint8_t> & to, std::vector<uint8_t> & delta)
+  {
+    delta.clear();
+    append(delta, to.size());
+
+    size_t offset = 0;
+    while (offset < to.size())
+    {
+      size_t length = std::min(ourBlockSize, to.size() - offset);
+      if (isBlockEqual(from, to, offset, length))
+      {
+        offset += length;
+        continue;
+      }
+
+      // merge the following blocks which differ too
+      size_t end = offset + length;
+      while (end < to.size())
+      {
+        length = std::min(ourBlockSize, to.size() - end);
+        if (isBlockEqual(from, to, end, length))
+        {
+          break;
+        }
+        end += length;
+      }
+
+      append(delta, offset);
+      append(delta, end - offset);
+      delta.insert(delta.end(), to.begin() + offset, to.begin() + end);
+      offset = end;
+    }
+  }
+
+  void applyDelta(const std::vector<uint8_t> & delta, std::vector<uint8_t> & state)
+  {
+    size_t pos = 0;
+    state.resize(read(delta, pos));
+
+    while (pos < delta.size())
+    {
+      const uint32_t offset = read(delta, pos);
+      const uint32_t length = read(delta, pos);
+      memcpy(state.data() + offset, delta.data() + pos, length);
+      pos += length;
+    }
+  }
+
+}
+
+namespace common2
+{
+
+  Rewind::Rewind(const size_t capacity)
+    : myCapacity(capacity)
+    , myDeltaBytes(0)
+  {
+  }
+
+  void Rewind::push()
+  {
+    // the state only changes size by a few bytes, so this is normally done in 1 go
+    myNext.resize(myNext.capacity());
+    size_t size = Snapshot_SaveStateToMemory(myNext.data(), myNext.size());
+    if (size > myNext.size())
+    {
+      myNext.resize(size);
+      size = Snapshot_SaveStateToMemory(myNext.data(), myNext.size());
+    }
+
+    if (size == 0 || size > myNext.size())
+    {
+      // already logged
+      return;
+    }
+
+    myNext.resize(size);
+
+    if (!myState.empty())
+    {
+      myDeltas.emplace_back();
+      makeDelta(myNext, myState, myDeltas.back());
+      myDeltaBytes += myDeltas.back().size();
+
+      while (myDeltaBytes > myCapacity && !myDeltas.empty())
+      {
+        myDeltaBytes -= myDeltas.front().size();
+        myDeltas.pop_front();
+      }
+    }
+
+    std::swap(myState, myNext);
+  }
+
+  bool Rewind::pop(const size_t steps)
+  {
+    if (myState.empty())
+    {
+      return false;
+    }
+
+    const size_t count = std::min(steps, myDeltas.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+      applyDelta(myDeltas.back(), myState);
+      myDeltaBytes -= myDeltas.back().size();
+      myDeltas.pop_back();
+    }
+
+    return Snapshot_LoadStateFromMemory(myState.data(), myState.size());
+  }
+
+  void Rewind::clear()
+  {
+    myState.clear();
+    myDeltas.clear();
+    myDeltaBytes = 0;
+  }
+
+  size_t Rewind::getNumberOfSnapshots() const
+  {
+    return myState.empty() ? 0 : myDeltas.size() + 1;
+  }
+
+  size_t Rewind::getMemoryUsed() const
+  {
+    return myDeltaBytes + myState.size();
+  }
+
+}
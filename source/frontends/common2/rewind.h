@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace common2
+{
+
+  // ring of emulator snapshots for rewind
+  //
+  // only the latest snapshot is kept in full (binary save-state)
+  // older ones are stored as backward deltas: the blocks which differ from the following snapshot
+  // between 2 video frames only a few pages change, so each delta is a few KB
+  class Rewind
+  {
+  public:
+    // capacity: bytes used by the deltas, the oldest are dropped first
+    explicit Rewind(const size_t capacity);
+
+    // append the current emulator state
+    void push();
+
+    // go back "steps" snapshots (or to the oldest) and load it
+    // the restored state becomes the latest snapshot
+    // false if there is nothing to restore or it fails to load
+    bool pop(const size_t steps);
+
+    void clear();
+
+    size_t getNumberOfSnapshots() const;
+    size_t getMemoryUsed() const;
+
+  private:
+    const size_t myCapacity;
+    size_t myDeltaBytes;
+
+    std::vector<uint8_t> myState;  // latest full snapshot
+    std::vector<uint8_t> myNext;   // scratch for the next snapshot
+    std::deque<std::vector<uint8_t>> myDeltas;  // myDeltas.back() turns myState into the previous snapshot
+  };
+
+}
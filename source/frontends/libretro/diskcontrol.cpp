@@ -374,8 +374,7 @@ namespace ra2
     myEjected = buffer.get<bool const>();
     myIndex = buffer.get<size_t const>();
     size_t const numberOfImages = buffer.get<size_t const>();
-    myImages.clear();
-    myImages.resize(numberOfImages);
+    myImages.resize(numberOfImages);  // NB. reuses the strings' buffers
 
     for (DiskInfo & image : myImages)
     {
@@ -311,6 +311,7 @@ void retro_run(void)
 bool retro_load_game(const retro_game_info *info)
 {
   ourGame.reset();
+  ra2::RetroSerialisation::reset();
   ra2::log_cb(RETRO_LOG_INFO, "RA2: %s\n", __FUNCTION__);
 
   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
@@ -458,7 +459,7 @@ void *retro_get_memory_data(unsigned id)
   switch (id & RETRO_MEMORY_MASK)
   {
   case RETRO_MEMORY_SYSTEM_RAM:
-    return MemGetBankPtr(0, true);
+    return MemGetBankPtr(0);
   default:
     return nullptr;
   };
@@ -1,15 +1,22 @@
 #include "StdAfx.h"
 #include "SaveState.h"
+#include "YamlHelper.h"
+#include "CardManager.h"
+#include "Harddisk.h"
 
 #include "frontends/libretro/serialisation.h"
 #include "frontends/libretro/diskcontrol.h"
 
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <unistd.h>
 
 namespace
 {
+
+  // states serialised before the binary format are a YAML file
+  // they can only be loaded from a file, so go via a temporary one
   class AutoFile
   {
   public:
@@ -45,10 +52,58 @@ namespace
     return myFilename;
   }
 
-  void saveToFile(const std::string & filename)  // cannot be null!
+  // anything without the binary magic is handed to the YAML parser (which rejects garbage)
+  bool isYamlState(const char * begin, const char * end)
+  {
+    const size_t length = sizeof(SS_BINARY_MAGIC);
+    return size_t(end - begin) < length || memcmp(begin, SS_BINARY_MAGIC, length) != 0;
+  }
+
+  bool loadYamlState(const char * begin, const char * end)
   {
+    AutoFile autoFile;
+    std::string const & filename = autoFile.getFilename();
+    // do not remove the {} scope below! it ensures the file is flushed
+    {
+      std::ofstream ofs(filename, std::ios::binary);
+      ofs.write(begin, end - begin);
+    }
+
+    // do not leave the user's save-state filename pointing at the temporary file
+    const std::string pathname = Snapshot_GetPathname();
     Snapshot_SetFilename(filename);
-    Snapshot_SaveState();
+    const bool loaded = Snapshot_LoadState();
+    Snapshot_SetFilename(pathname);
+    return loaded;
+  }
+
+  // RetroArch sizes its buffers from retro_serialize_size() (rewind, run-ahead, netplay), so it must not change
+  // it's measured once per game, as the machine & its cards don't change while the game runs
+  size_t ourSerialisationSize = 0;
+
+  // the most that the disks can add to the save-state, when each drive has a disk inserted
+  size_t getDisksSize()
+  {
+    const size_t names = 2 * MAX_PATH + 512;  // filename, absolute path & the other keys
+    const size_t floppy = 16 * 512 + names;   // track image: a WOZ's largest track is ~13 blocks of 512 bytes
+    const size_t harddisk = HD_BLOCK_SIZE + names;
+
+    size_t size = 0;
+    for (UINT slot = SLOT0; slot < NUM_SLOTS; ++slot)
+    {
+      switch (GetCardMgr().QuerySlot(slot))
+      {
+      case CT_Disk2:
+        size += NUM_DRIVES * floppy;
+        break;
+      case CT_GenericHDD:
+        size += NUM_HARDDISKS * harddisk;
+        break;
+      default:
+        break;
+      }
+    }
+    return size;
   }
 
 }
@@ -56,20 +111,34 @@ namespace
 namespace ra2
 {
 
+  void RetroSerialisation::reset()
+  {
+    ourSerialisationSize = 0;
+  }
+
   size_t RetroSerialisation::getSize()
   {
-    AutoFile autoFile;
-    std::string const & filename = autoFile.getFilename();
-    saveToFile(filename);
-    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    if (ourSerialisationSize)
+    {
+      return ourSerialisationSize;
+    }
+
+    // binary save-state with a NULL buffer: just counts the size, no I/O
+    const size_t stateSize = Snapshot_SaveStateToMemory(NULL, 0);
+    if (stateSize == 0)
+    {
+      throw std::runtime_error("Cannot measure save-state");
+    }
 
-    const size_t fileSize = ifs.tellg();
     // we add a buffer to include a few things
+    // a disk in every drive (whatever is inserted now)
     // DiscControl images
     // various sizes
-    // small variations in AW yaml format
-    const size_t buffer = 4096;
-    return fileSize + buffer;
+    // small variations in the state (e.g. Mockingboard's AY8910 changes)
+    const size_t buffer = getDisksSize() + 16384;
+    const size_t alignment = 4096;
+    ourSerialisationSize = (stateSize + buffer + alignment - 1) / alignment * alignment;
+    return ourSerialisationSize;
   }
 
   void RetroSerialisation::serialise(void * data, size_t size, const DiskControl & diskControl)
@@ -77,19 +146,20 @@ namespace ra2
     Buffer buffer(reinterpret_cast<char *>(data), size);
     diskControl.serialise(buffer);
 
-    AutoFile autoFile;
-    std::string const & filename = autoFile.getFilename();
-    saveToFile(filename);
-    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
-
-    size_t const fileSize = ifs.tellg();
-    buffer.get<size_t>() = fileSize;
+    size_t & stateSize = buffer.get<size_t>();
 
     char * begin, * end;
-    buffer.get(fileSize, begin, end);
+    buffer.get(0, begin, end);
+    const size_t available = size - (begin - reinterpret_cast<char *>(data));
+
+    stateSize = Snapshot_SaveStateToMemory(reinterpret_cast<BYTE *>(begin), available);
+    if (stateSize == 0 || stateSize > available)
+    {
+      throw std::runtime_error("Save-state does not fit in buffer");
+    }
 
-    ifs.seekg(0, std::ios::beg);
-    ifs.read(begin, end - begin);
+    // keep the unused tail deterministic (rewind & netplay compare states)
+    memset(begin + stateSize, 0, available - stateSize);
   }
 
   void RetroSerialisation::deserialise(const void * data, size_t size, DiskControl & diskControl)
@@ -97,22 +167,20 @@ namespace ra2
     Buffer buffer(reinterpret_cast<const char *>(data), size);
     diskControl.deserialise(buffer);
 
-    const size_t fileSize = buffer.get<size_t const>();
+    const size_t stateSize = buffer.get<size_t const>();
 
-    AutoFile autoFile;
-    std::string const & filename = autoFile.getFilename();
-    // do not remove the {} scope below! it ensures the file is flushed
-    {
-      char const * begin, * end;
-      buffer.get(fileSize, begin, end);
-      std::ofstream ofs(filename, std::ios::binary);
-      ofs.write(begin, end - begin);
-    }
+    char const * begin, * end;
+    buffer.get(stateSize, begin, end);
 
     // bit of a workaround, since the state files do not have full disk paths
     SetCurrentDirectory(diskControl.getCurrentDiskFolder().c_str());
-    Snapshot_SetFilename(filename);
-    Snapshot_LoadState();
+    const bool loaded = isYamlState(begin, end)
+      ? loadYamlState(begin, end)
+      : Snapshot_LoadStateFromMemory(reinterpret_cast<const BYTE *>(begin), end - begin);
+    if (!loaded)
+    {
+      throw std::runtime_error("Cannot load save-state");
+    }
   }
 
 }
@@ -8,6 +8,7 @@ namespace ra2
   class RetroSerialisation
   {
   public:
+    static void reset();  // a new game: measure the size again
     static size_t getSize();
     static void serialise(void * data, size_t size, const DiskControl & diskControl);
     static void deserialise(const void * data, size_t size, DiskControl & diskControl);
@@ -13,6 +13,8 @@
 #include "frontends/common2/fileregistry.h"
 #include "frontends/common2/programoptions.h"
 #include "frontends/common2/commoncontext.h"
+#include "frontends/common2/batch.h"
+#include "frontends/common2/benchsuite.h"
 #include "frontends/ncurses/world.h"
 #include "frontends/ncurses/nframe.h"
 #include "frontends/ncurses/evdevpaddle.h"
@@ -117,6 +119,17 @@ namespace
     if (!run)
       return 1;
 
+    if (!options.batchFile.empty())
+    {
+      // each image runs in its own process with a headless frame
+      return common2::runBatch(options);
+    }
+
+    if (options.benchSuite)
+    {
+      return common2::runBenchSuite(options);
+    }
+
     const LoggerContext loggerContext(options.log);
     const RegistryContext registryContet(CreateFileRegistry(options));
     const std::shared_ptr<na2::EvDevPaddle> paddle = std::make_shared<na2::EvDevPaddle>(options.paddleDeviceName);
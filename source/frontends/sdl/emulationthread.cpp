@@ -0,0 +1,80 @@
+#include "StdAfx.h"
+#include "frontends/sdl/emulationthread.h"
+#include "frontends/sdl/sdlframe.h"
+
+#include "Core.h"
+
+namespace sa2
+{
+
+  EmulationThread::EmulationThread(const std::shared_ptr<SDLFrame> & frame, const int64_t frameMicros, common2::Timer & cpuTimer)
+    : myFrame(frame)
+    , myFrameMicros(frameMicros)
+    , myCpuTimer(cpuTimer)
+    , myTick(false)
+    , myQuit(false)
+  {
+    myThread = std::thread(&EmulationThread::run, this);
+    // the thread waits for the first tick, which orders this
+    myFrame->SetEmulationThread(myThread.get_id());
+  }
+
+  EmulationThread::~EmulationThread()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(myMutex);
+      myQuit = true;
+    }
+    myCondition.notify_one();
+    myThread.join();
+
+    const std::lock_guard<EmulatorMutex> lock(myFrame->GetEmulatorMutex());
+    myFrame->SetEmulationThread(std::thread::id());
+  }
+
+  void EmulationThread::tick()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(myMutex);
+      myTick = true;
+    }
+    myCondition.notify_one();
+  }
+
+  void EmulationThread::run()
+  {
+    bool fullSpeed = false;
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(myMutex);
+        myCondition.wait(lock, [this, fullSpeed] { return myQuit || myTick || fullSpeed; });
+        if (myQuit)
+        {
+          break;
+        }
+        myTick = false;
+      }
+
+      myCpuTimer.tic();
+      {
+        // one frame per lock: at full speed the main thread (if waiting) gets the mutex next
+        const std::lock_guard<EmulatorMutex> lock(myFrame->GetEmulatorMutex());
+        myFrame->ExecuteOneFrame(myFrameMicros);
+
+        // on this thread VideoPresentScreen() only hands the framebuffer over to the main thread
+        fullSpeed = g_bFullSpeed;
+        if (fullSpeed)
+        {
+          myFrame->VideoRedrawScreenDuringFullSpeed(g_dwCyclesThisFrame);
+        }
+        else
+        {
+          myFrame->VideoPresentScreen();
+        }
+      }
+      myCpuTimer.toc();
+    }
+  }
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "frontends/common2/timer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sa2
+{
+
+  class SDLFrame;
+
+  // runs CommonFrame::ExecuteOneFrame on a separate thread
+  //
+  // the main thread keeps the events, the texture upload and the presentation
+  // so blocking in SDL_GL_SwapWindow (vsync) does not take time away from the emulator
+  // both threads hold SDLFrame::GetEmulatorMutex() while they touch the emulator
+  // (a fair mutex, so the main thread is not starved at full speed)
+  class EmulationThread
+  {
+  public:
+    EmulationThread(const std::shared_ptr<SDLFrame> & frame, const int64_t frameMicros, common2::Timer & cpuTimer);
+    ~EmulationThread();
+
+    // let the emulator run the next frame (once per main loop iteration)
+    // at full speed it does not wait
+    void tick();
+
+  private:
+    void run();
+
+    const std::shared_ptr<SDLFrame> myFrame;
+    const int64_t myFrameMicros;
+    common2::Timer & myCpuTimer;  // only used on the emulation thread
+
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    bool myTick;
+    bool myQuit;
+
+    std::thread myThread;
+  };
+
+}
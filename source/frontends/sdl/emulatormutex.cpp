@@ -0,0 +1,45 @@
+#include "StdAfx.h"
+#include "frontends/sdl/emulatormutex.h"
+
+namespace sa2
+{
+
+  EmulatorMutex::EmulatorMutex()
+    : myNextTicket(0)
+    , myServing(0)
+    , myDepth(0)
+  {
+  }
+
+  void EmulatorMutex::lock()
+  {
+    const std::thread::id id = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(myMutex);
+    if (myDepth > 0 && myOwner == id)
+    {
+      ++myDepth;
+      return;
+    }
+
+    const uint64_t ticket = myNextTicket++;
+    myCondition.wait(lock, [this, ticket] { return myServing == ticket; });
+    myOwner = id;
+    myDepth = 1;
+  }
+
+  void EmulatorMutex::unlock()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(myMutex);
+      if (--myDepth > 0)
+      {
+        return;
+      }
+      myOwner = std::thread::id();
+      ++myServing;
+    }
+    // several threads can wait, only the one with the next ticket goes
+    myCondition.notify_all();
+  }
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace sa2
+{
+
+  // recursive mutex which is handed over in the order threads asked for it (a ticket lock)
+  //
+  // std::recursive_mutex is not fair: at full speed the emulation thread takes it again
+  // as soon as it releases it, and the main thread could wait for many frames
+  // with this, whoever is already waiting gets it first
+  // usable with std::lock_guard
+  class EmulatorMutex
+  {
+  public:
+    EmulatorMutex();
+
+    void lock();
+    void unlock();
+
+  private:
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    uint64_t myNextTicket;
+    uint64_t myServing;  // ticket of the owner (or of the next one if there is no owner)
+
+    std::thread::id myOwner;
+    size_t myDepth;
+  };
+
+}
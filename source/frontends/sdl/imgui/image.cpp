@@ -36,6 +36,11 @@ namespace sa2
   }
 
   void loadTextureFromData(GLuint texture, const uint8_t * data, size_t width, size_t height, size_t pitch)
+  {
+    loadTextureRows(texture, data, width, 0, height, pitch);
+  }
+
+  void loadTextureRows(GLuint texture, const uint8_t * data, size_t width, size_t y, size_t rows, size_t pitch)
   {
     glBindTexture(GL_TEXTURE_2D, texture);
     glPixelStorei(UGL_UNPACK_LENGTH, pitch); // in pixels
@@ -47,7 +52,8 @@ namespace sa2
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     const GLenum type = GL_UNSIGNED_BYTE;
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, SA2_IMAGE_FORMAT, type, data);
+    // 4 bytes per pixel (BGRA)
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, width, rows, SA2_IMAGE_FORMAT, type, data + y * pitch * 4);
     // reset to default state
     glPixelStorei(UGL_UNPACK_LENGTH, 0);
   }
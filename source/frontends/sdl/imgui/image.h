@@ -8,5 +8,7 @@ namespace sa2
 
   void allocateTexture(GLuint texture, size_t width, size_t height);
   void loadTextureFromData(GLuint texture, const uint8_t * data, size_t width, size_t height, size_t pitch);
+  // only rows [y, y + rows): data still points to row 0
+  void loadTextureRows(GLuint texture, const uint8_t * data, size_t width, size_t y, size_t rows, size_t pitch);
 
 }
@@ -122,6 +122,7 @@ namespace sa2
 
     myDeadTopZone = 0;
     myTexture = 0;
+    myTextureStale = true;
   }
 
   SDLImGuiFrame::~SDLImGuiFrame()
@@ -153,11 +154,27 @@ namespace sa2
     myOffset = (width * borderHeight + borderWidth) * sizeof(bgra_t);
 
     allocateTexture(myTexture, myBorderlessWidth, myBorderlessHeight);
+    myTextureStale = true;
   }
 
   void SDLImGuiFrame::UpdateTexture()
   {
-    loadTextureFromData(myTexture, myFramebuffer.data() + myOffset, myBorderlessWidth, myBorderlessHeight, myPitch);
+    DirtyScanlines_t dirty;
+    const uint8_t * data = GetPresentFramebuffer(dirty) + myOffset;
+
+    if (myTextureStale)
+    {
+      loadTextureFromData(myTexture, data, myBorderlessWidth, myBorderlessHeight, myPitch);
+      myTextureStale = false;
+      return;
+    }
+
+    // a synchronous glTexSubImage2D of the whole frame is slow on software GL (llvmpipe)
+    GetDirtyRows(dirty, myBorderlessHeight, myDirtyRows);
+    for (const auto & rows : myDirtyRows)
+    {
+      loadTextureRows(myTexture, data, myBorderlessWidth, rows.first, rows.second, myPitch);
+    }
   }
 
   void SDLImGuiFrame::ClearBackground()
@@ -225,27 +242,37 @@ namespace sa2
 
   void SDLImGuiFrame::VideoPresentScreen()
   {
+    if (PublishFrame())
+    {
+      return;
+    }
+
     // this is NOT REENTRANT
     // the debugger (executed via mySettings.show(this)) might call it recursively
     if (!myPresenting)
     {
       myPresenting = true;
-      ImGui_ImplOpenGL3_NewFrame();
-      ImGui_ImplSDL2_NewFrame();
-      ImGui::NewFrame();
-
-      if (!myShowMouseCursor)
       {
-        ImGui::SetMouseCursor(ImGuiMouseCursor_None);
-      } // otherwise leave it to the default set in ImGui::NewFrame();
+        // the settings and the debugger work on the emulator
+        const std::lock_guard<EmulatorMutex> lock(myEmulatorMutex);
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplSDL2_NewFrame();
+        ImGui::NewFrame();
 
-      // "this" is a bit circular
-      mySettings.show(this, myDebuggerFont);
-      DrawAppleVideo();
+        if (!myShowMouseCursor)
+        {
+          ImGui::SetMouseCursor(ImGuiMouseCursor_None);
+        } // otherwise leave it to the default set in ImGui::NewFrame();
+
+        // "this" is a bit circular
+        mySettings.show(this, myDebuggerFont);
+        DrawAppleVideo();
 
-      ImGui::Render();
-      ClearBackground();
-      ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        ImGui::Render();
+        ClearBackground();
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+      }
+      // this can block until vsync
       SDL_GL_SwapWindow(myWindow.get());
       myPresenting = false;
     }
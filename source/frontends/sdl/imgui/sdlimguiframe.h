@@ -45,6 +45,8 @@ namespace sa2
 
     SDL_GLContext myGLContext;
     ImTextureID myTexture;
+    bool myTextureStale;  // next upload is the whole texture
+    std::vector<std::pair<size_t, size_t>> myDirtyRows;
 
     std::string myIniFileLocation;
     ImFont* myDebuggerFont;
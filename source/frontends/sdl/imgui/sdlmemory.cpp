@@ -37,7 +37,7 @@ namespace sa2
             {
               hex << ' ';
             }
-            const int value = static_cast<int>(mem[(base + k) & _6502_MEM_END]);
+            const int value = static_cast<int>(ReadByteFromMemory((base + k) & _6502_MEM_END));
             hex << std::setw(2) << value;
             text << getPrintableChar(value);
           }
@@ -44,7 +44,7 @@ namespace
     {"F8", "Settings"},
     {"F9", "Cycle video type", "Toggle mouse cursor"},
     {"F11", "Save snapshot"},
-    {"F12", "Load snapshot"},
+    {"F12", "Load snapshot", "Rewind"},
   };
 
   const char * ourDebuggerShortcutKeys[][6] = {
@@ -356,6 +356,30 @@ namespace sa2
             cardManager.GetDisk2CardMgr().SetEnhanceDisk(enhancedSpeed);
             REGSAVE(TEXT(REGVALUE_ENHANCE_DISK_SPEED), (DWORD)enhancedSpeed);
           }
+          bool fastDisk = cardManager.GetDisk2CardMgr().GetFastDisk();
+          if (ImGui::Checkbox("Fast disk", &fastDisk))
+          {
+            cardManager.GetDisk2CardMgr().SetFastDisk(fastDisk);
+            REGSAVE(TEXT(REGVALUE_FAST_DISK), (DWORD)fastDisk);
+          }
+          ImGui::SameLine(); HelpMarker("Complete boot PROM and DOS 3.3 RWTS sector accesses in one step (not for WOZ images).");
+
+          for (int slot = SLOT5; slot < NUM_SLOTS; ++slot)
+          {
+            if (cardManager.QuerySlot(slot) == CT_GenericHDD)
+            {
+              ImGui::PushID(slot);
+              bool blockCache = HarddiskInterfaceCard::GetRegistryBlockCache(slot);
+              const std::string label = "HDD block cache (slot " + std::to_string(slot) + ")";
+              if (ImGui::Checkbox(label.c_str(), &blockCache))
+              {
+                HarddiskInterfaceCard::SetRegistryBlockCache(slot, blockCache);
+                dynamic_cast<HarddiskInterfaceCard*>(cardManager.GetObj(slot))->SetBlockCache(blockCache);
+              }
+              ImGui::SameLine(); HelpMarker("Read uncompressed images in 16KB extents and write blocks back when the drive is idle, ejected or saved.");
+              ImGui::PopID();
+            }
+          }
 
           ImGui::Separator();
 
@@ -905,12 +929,13 @@ namespace sa2
       {
         std::vector<MemoryTab> banks;
 
-        banks.push_back({mem, 0, _6502_MEM_LEN, "Memory"});
+        // a snapshot of the 64K as currently mapped (edits are not written back): use the banks below to modify memory
+        banks.push_back({MemUpdateView(), 0, _6502_MEM_LEN, "Memory"});
         banks.push_back({MemGetCxRomPeripheral(), _6502_IO_BEGIN, 4 * 1024, "Cx ROM"});
 
         size_t i = 0;
         void * bank;
-        while ((bank = MemGetBankPtr(i, true)))
+        while ((bank = MemGetBankPtr(i)))
         {
           const std::string name = "Bank " + std::to_string(i);
           banks.push_back({bank, 0, _6502_MEM_LEN, name});
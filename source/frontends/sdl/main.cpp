@@ -12,6 +12,7 @@
 #include "frontends/common2/commoncontext.h"
 #include "frontends/common2/programoptions.h"
 #include "frontends/common2/timer.h"
+#include "frontends/sdl/emulationthread.h"
 #include "frontends/sdl/gamepad.h"
 #include "frontends/sdl/sdirectsound.h"
 #include "frontends/sdl/utils.h"
@@ -125,22 +126,40 @@ void run_sdl(int argc, const char * argv [])
 
     bool quit = false;
 
+    // the emulator runs the next frame while this one is presented
+    std::unique_ptr<sa2::EmulationThread> emulation;
+    if (options.emulationThread && !options.headless)
+    {
+      emulation = std::make_unique<sa2::EmulationThread>(frame, oneFrameMicros, cpuTimer);
+    }
+
     do
     {
       frameTimer.tic();
 
       eventTimer.tic();
-      frame->ProcessEvents(quit);
+      {
+        // only contended with an emulation thread
+        const std::lock_guard<sa2::EmulatorMutex> lock(frame->GetEmulatorMutex());
+        frame->ProcessEvents(quit);
+      }
       eventTimer.toc();
 
-      cpuTimer.tic();
-      frame->ExecuteOneFrame(oneFrameMicros);
-      cpuTimer.toc();
+      if (emulation)
+      {
+        emulation->tick();
+      }
+      else
+      {
+        cpuTimer.tic();
+        frame->ExecuteOneFrame(oneFrameMicros);
+        cpuTimer.toc();
+      }
 
       if (!options.headless)
       {
         refreshScreenTimer.tic();
-        if (g_bFullSpeed)
+        if (!emulation && g_bFullSpeed)
         {
           frame->VideoRedrawScreenDuringFullSpeed(g_dwCyclesThisFrame);
         }
@@ -154,6 +173,8 @@ void run_sdl(int argc, const char * argv [])
       frameTimer.toc();
     } while (!quit && !frame->Quit());
 
+    emulation.reset();
+
     global.toc();
 
     std::cerr << "Global:  " << global << std::endl;
@@ -13,6 +13,7 @@ namespace sa2
 
   SDLRendererFrame::SDLRendererFrame(const common2::EmulatorOptions & options)
     : SDLFrame(options)
+    , myTextureStale(true)
   {
     const common2::Geometry geometry = getGeometryOrDefault(options.geometry);
 
@@ -50,18 +51,72 @@ namespace sa2
       throw std::runtime_error(decorateSDLError("SDL_RenderSetLogicalSize"));
     }
 
-    myTexture.reset(SDL_CreateTexture(myRenderer.get(), ourPixelFormat, SDL_TEXTUREACCESS_STATIC, width, height), SDL_DestroyTexture);
+    myTexture.reset(SDL_CreateTexture(myRenderer.get(), ourPixelFormat, SDL_TEXTUREACCESS_STREAMING, width, height), SDL_DestroyTexture);
+    myTextureStale = true;
 
     myRect.x = video.GetFrameBufferBorderWidth();
     myRect.y = video.GetFrameBufferBorderHeight();
     myRect.w = sw;
     myRect.h = sh;
     myPitch = width * sizeof(bgra_t);
+    myBorderHeight = video.GetFrameBufferBorderHeight();
+  }
+
+  void SDLRendererFrame::UpdateTexture(const uint8_t * framebuffer, const DirtyScanlines_t & dirty)
+  {
+    if (myTextureStale)
+    {
+      // borders included
+      SDL_UpdateTexture(myTexture.get(), nullptr, framebuffer, myPitch);
+      myTextureStale = false;
+      return;
+    }
+
+    GetDirtyRows(dirty, size_t(myRect.h), myDirtyRows);
+    for (const auto & rows : myDirtyRows)
+    {
+      // whole rows, so the undefined content of a locked streaming texture is overwritten
+      SDL_Rect rect;
+      rect.x = 0;
+      rect.y = myBorderHeight + rows.first;
+      rect.w = myPitch / sizeof(bgra_t);
+      rect.h = rows.second;
+
+      void * pixels;
+      int pitch;
+      if (SDL_LockTexture(myTexture.get(), &rect, &pixels, &pitch))
+      {
+        throw std::runtime_error(decorateSDLError("SDL_LockTexture"));
+      }
+
+      const uint8_t * source = framebuffer + rect.y * myPitch;
+      uint8_t * destination = static_cast<uint8_t *>(pixels);
+      for (int i = 0; i < rect.h; ++i)
+      {
+        memcpy(destination, source, myPitch);
+        source += myPitch;
+        destination += pitch;
+      }
+
+      SDL_UnlockTexture(myTexture.get());
+    }
   }
 
   void SDLRendererFrame::VideoPresentScreen()
   {
-    SDL_UpdateTexture(myTexture.get(), nullptr, myFramebuffer.data(), myPitch);
+    if (PublishFrame())
+    {
+      return;
+    }
+
+    const uint8_t * framebuffer;
+    DirtyScanlines_t dirty;
+    {
+      const std::lock_guard<EmulatorMutex> lock(myEmulatorMutex);
+      framebuffer = GetPresentFramebuffer(dirty);
+    }
+
+    UpdateTexture(framebuffer, dirty);
     SDL_RenderClear(myRenderer.get());
     SDL_RenderCopyEx(myRenderer.get(), myTexture.get(), &myRect, nullptr, 0.0, nullptr, SDL_FLIP_VERTICAL);
     SDL_RenderPresent(myRenderer.get());
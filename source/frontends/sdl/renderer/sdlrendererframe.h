@@ -2,6 +2,7 @@
 
 #include "frontends/sdl/sdlframe.h"
 #include <memory>
+#include <vector>
 
 namespace sa2
 {
@@ -21,11 +22,16 @@ namespace sa2
     void ToggleMouseCursor() override;
 
   private:
+    // only the rows which changed since the last upload
+    void UpdateTexture(const uint8_t * framebuffer, const DirtyScanlines_t & dirty);
 
     static constexpr SDL_PixelFormatEnum ourPixelFormat = SDL_PIXELFORMAT_ARGB8888;
 
     SDL_Rect myRect;
     int myPitch;
+    int myBorderHeight;
+    bool myTextureStale;  // next upload is the whole texture
+    std::vector<std::pair<size_t, size_t>> myDirtyRows;
 
     std::shared_ptr<SDL_Renderer> myRenderer;
     std::shared_ptr<SDL_Texture> myTexture;
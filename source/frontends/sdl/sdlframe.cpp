@@ -135,6 +135,8 @@ namespace sa2
     , myDragAndDropDrive(DRIVE_1)
     , myScrollLockFullSpeed(false)
     , myPortFwds(getPortFwds(options.natPortFwds))
+    , myReadyFrameFresh(false)
+    , myTitleChanged(false)
   {
   }
 
@@ -192,6 +194,12 @@ namespace sa2
   {
     if (drawflags & DRAW_TITLE)
     {
+      if (IsEmulationThread())
+      {
+        // picked up in ProcessEvents()
+        myTitleChanged = true;
+        return;
+      }
       GetAppleWindowTitle();
       SDL_SetWindowTitle(myWindow.get(), g_pAppTitle.c_str());
     }
@@ -262,6 +270,12 @@ namespace sa2
 
   void SDLFrame::ProcessEvents(bool &quit)
   {
+    if (myTitleChanged)
+    {
+      myTitleChanged = false;
+      FrameRefreshStatus(DRAW_TITLE);
+    }
+
     SDL_Event e;
     while (SDL_PollEvent(&e) != 0)
     {
@@ -433,6 +447,11 @@ namespace sa2
           {
             LoadSnapshot();
           }
+          else if (modifiers == KMOD_CTRL)
+          {
+            // 1 second
+            RewindHistory(1000000);
+          }
           break;
         }
       case SDLK_F11:
@@ -661,6 +680,110 @@ namespace sa2
     }
   }
 
+  EmulatorMutex & SDLFrame::GetEmulatorMutex()
+  {
+    return myEmulatorMutex;
+  }
+
+  void SDLFrame::SetEmulationThread(const std::thread::id & id)
+  {
+    myEmulationThread = id;
+    myReadyFrameFresh = false;
+    // the textures are about to come from a different buffer
+    myPendingDirty.set();
+  }
+
+  bool SDLFrame::IsEmulationThread() const
+  {
+    return myEmulationThread != std::thread::id() && myEmulationThread == std::this_thread::get_id();
+  }
+
+  bool SDLFrame::PublishFrame()
+  {
+    if (!IsEmulationThread())
+    {
+      return false;
+    }
+
+    // the emulator mutex is held, the main thread swaps it in GetPresentFramebuffer()
+    myReadyFrame.assign(myFramebuffer.begin(), myFramebuffer.end());
+    myReadyFrameFresh = true;
+
+    // the front frame could be a few frames behind: accumulate
+    DirtyScanlines_t dirty;
+    NTSC_VideoGetDirtyScanlines(dirty);
+    myReadyDirty |= dirty;
+    return true;
+  }
+
+  const uint8_t * SDLFrame::GetPresentFramebuffer(DirtyScanlines_t & dirty)
+  {
+    dirty = myPendingDirty;
+    myPendingDirty.reset();
+
+    if (myEmulationThread == std::thread::id())
+    {
+      DirtyScanlines_t rendered;
+      NTSC_VideoGetDirtyScanlines(rendered);
+      dirty |= rendered;
+      return myFramebuffer.data();
+    }
+
+    if (myReadyFrameFresh)
+    {
+      std::swap(myReadyFrame, myFrontFrame);
+      myReadyFrameFresh = false;
+      dirty |= myReadyDirty;
+      myReadyDirty.reset();
+    }
+
+    if (myFrontFrame.size() != myFramebuffer.size())
+    {
+      // nothing published since the framebuffer was (re)allocated
+      myFrontFrame = myFramebuffer;
+      dirty.set();
+    }
+
+    // only the main thread touches myFrontFrame, so it can be used after the mutex is released
+    return myFrontFrame.data();
+  }
+
+  void SDLFrame::GetDirtyRows(const DirtyScanlines_t & dirty, const size_t height, std::vector<std::pair<size_t, size_t>> & rows)
+  {
+    rows.clear();
+
+    // scanline "y" is drawn on rows 2y & 2y+1 (from the top) and blended into 2y-1 (see NTSC.cpp)
+    // merge all of them, flipped vertically
+    for (size_t y = 0; y < dirty.size(); ++y)
+    {
+      if (!dirty.test(y))
+      {
+        continue;
+      }
+
+      const size_t top = y > 0 ? 2 * y - 1 : 0;
+      const size_t bottom = std::min(2 * y + 2, height);  // exclusive
+      if (top >= bottom)
+      {
+        break;
+      }
+
+      const size_t first = height - bottom;
+      const size_t count = bottom - top;
+      if (!rows.empty() && rows.back().first <= first + count)
+      {
+        // extend the previous run downwards
+        const size_t end = rows.back().first + rows.back().second;
+        rows.back().first = first;
+        rows.back().second = end - first;
+      }
+      else
+      {
+        rows.emplace_back(first, count);
+      }
+    }
+  }
+
   bool SDLFrame::CanDoFullSpeed()
   {
     return myScrollLockFullSpeed || CommonFrame::CanDoFullSpeed();
@@ -3,9 +3,14 @@
 #include "frontends/common2/gnuframe.h"
 #include "frontends/common2/controllerdoublepress.h"
 #include "frontends/common2/programoptions.h"
+#include "frontends/sdl/emulatormutex.h"
 #include "linux/network/portfwds.h"
+#include "NTSC.h"
 #include <SDL.h>
 
+#include <mutex>
+#include <thread>
+
 namespace sa2
 {
 
@@ -42,7 +47,25 @@ namespace sa2
 
     static void setGLSwapInterval(const int interval);
 
+    // with an EmulationThread, the main thread must hold this while it touches the emulator
+    EmulatorMutex & GetEmulatorMutex();
+    void SetEmulationThread(const std::thread::id & id);
+
   protected:
+    bool IsEmulationThread() const;
+
+    // on the emulation thread: copy the framebuffer for the main thread and return true
+    // VideoPresentScreen() must not go any further there
+    bool PublishFrame();
+    // framebuffer to upload: the latest published one if there is an emulation thread
+    // "dirty" gets the scanlines which changed since the last call
+    // must be called with the emulator mutex
+    const uint8_t * GetPresentFramebuffer(DirtyScanlines_t & dirty);
+
+    // the texture rows covered by the dirty scanlines, as [first, first + count) runs
+    // rows are counted from the bottom of the borderless framebuffer (as in the textures)
+    static void GetDirtyRows(const DirtyScanlines_t & dirty, const size_t height, std::vector<std::pair<size_t, size_t>> & rows);
+
     void SetApplicationIcon();
     void SetGLSynchronisation(const common2::EmulatorOptions & options);
 
@@ -79,6 +102,16 @@ namespace sa2
 
     std::shared_ptr<SDL_Window> myWindow;
 
+    EmulatorMutex myEmulatorMutex;
+    std::thread::id myEmulationThread;  // default: the emulator runs on the main thread
+    // myFramebuffer (written by the emulator) -> myReadyFrame -> myFrontFrame (uploaded by the main thread)
+    std::vector<uint8_t> myReadyFrame;
+    std::vector<uint8_t> myFrontFrame;
+    bool myReadyFrameFresh;
+    DirtyScanlines_t myReadyDirty;  // since the last swap into myFrontFrame
+    DirtyScanlines_t myPendingDirty;  // to add to the next GetPresentFramebuffer()
+    bool myTitleChanged;  // SDL_SetWindowTitle is only called on the main thread
+
     common2::ControllerDoublePress myControllerQuit;
   };
 
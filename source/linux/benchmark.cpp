@@ -20,8 +20,10 @@ void VideoBenchmark(std::function<void()> redraw, std::function<void()> refresh)
   Video & video = GetVideo();
   // PREPARE TWO DIFFERENT FRAME BUFFERS, EACH OF WHICH HAVE HALF OF THE
   // BYTES SET TO 0x14 AND THE OTHER HALF SET TO 0xAA
+  // the video reads main memory directly
+  LPBYTE  memmain = MemGetMainPtr(0);
   int     loop;
-  LPDWORD mem32 = (LPDWORD)mem;
+  LPDWORD mem32 = (LPDWORD)memmain;
   for (loop = 4096; loop < 6144; loop++)
     *(mem32+loop) = ((loop & 1) ^ ((loop & 0x40) >> 6)) ? 0x14141414
                                                         : 0xAAAAAAAA;
@@ -33,7 +35,7 @@ void VideoBenchmark(std::function<void()> redraw, std::function<void()> refresh)
   // GOING ON, CHANGING HALF OF THE BYTES IN THE VIDEO BUFFER EACH FRAME TO
   // SIMULATE THE ACTIVITY OF AN AVERAGE GAME
   video.SetVideoMode(VF_HIRES);
-  memset(mem+0x2000,0x14,0x2000);
+  memset(memmain+0x2000,0x14,0x2000);
   redraw();
 
   typedef std::chrono::microseconds interval_t;
@@ -45,9 +47,9 @@ void VideoBenchmark(std::function<void()> redraw, std::function<void()> refresh)
   auto start = std::chrono::steady_clock::now();
   do {
     if (totalhiresfps & 1)
-      memset(mem+0x2000,0x14,0x2000);
+      memset(memmain+0x2000,0x14,0x2000);
     else
-      memcpy(mem+0x2000,mem+((totalhiresfps & 2) ? 0x4000 : 0x6000),0x2000);
+      memcpy(memmain+0x2000,memmain+((totalhiresfps & 2) ? 0x4000 : 0x6000),0x2000);
     refresh();
     totalhiresfps++;
 
@@ -126,7 +128,7 @@ void VideoBenchmark(std::function<void()> redraw, std::function<void()> refresh)
   // WITH FULL EMULATION OF THE CPU, JOYSTICK, AND DISK HAPPENING AT
   // THE SAME TIME
   counter_t realisticfps = 0;
-  memset(mem+0x2000,0xAA,0x2000);
+  memset(memmain+0x2000,0xAA,0x2000);
   redraw();
 
   const size_t dwClksPerFrame = NTSC_GetCyclesPerFrame();
@@ -148,9 +150,9 @@ void VideoBenchmark(std::function<void()> redraw, std::function<void()> refresh)
     {
       cyclesThisFrame -= dwClksPerFrame;
       if (realisticfps & 1)
-	memset(mem+0x2000,0xAA,0x2000);
+	memset(memmain+0x2000,0xAA,0x2000);
       else
-	memcpy(mem+0x2000,mem+((realisticfps & 2) ? 0x4000 : 0x6000),0x2000);
+	memcpy(memmain+0x2000,memmain+((realisticfps & 2) ? 0x4000 : 0x6000),0x2000);
       realisticfps++;
       refresh();
     }
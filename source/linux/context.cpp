@@ -129,6 +129,5 @@ void DestroyEmulator()
   MemDestroy();
   SpkrDestroy();
   DSUninit();
-  CpuDestroy();
   DebugDestroy();
 }
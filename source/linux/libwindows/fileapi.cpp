@@ -3,6 +3,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 namespace
@@ -19,6 +23,26 @@ namespace
       }
     }
   };
+
+  struct FILE_MAPPING_HANDLE : public CHANDLE
+  {
+    // the file descriptor is duplicated, as the mapping can outlive the file handle
+    FILE_MAPPING_HANDLE(int ffd, DWORD protect) : fd(ffd), flProtect(protect) {}
+    int fd = -1;
+    DWORD flProtect = 0;
+    ~FILE_MAPPING_HANDLE() override
+    {
+      if (fd >= 0)
+      {
+        close(fd);
+      }
+    }
+  };
+
+  // munmap() needs the size of the view
+  // NB. images can be opened & closed on the emulation/batch threads as well as the main one
+  std::mutex viewsMutex;
+  std::map<LPCVOID, size_t> views;
 }
 
 DWORD SetFilePointer(HANDLE hFile, LONG lDistanceToMove,
@@ -152,6 +176,81 @@ DWORD GetCurrentDirectory(DWORD length, char * buffer)
   }
 }
 
+HANDLE CreateFileMapping(HANDLE hFile, LPSECURITY_ATTRIBUTES lpFileMappingAttributes, DWORD flProtect,
+                         DWORD dwMaximumSizeHigh, DWORD dwMaximumSizeLow, LPCTSTR lpName)
+{
+  if (hFile == INVALID_HANDLE_VALUE)
+  {
+    return NULL;
+  }
+
+  const FILE_HANDLE & file_handle = dynamic_cast<FILE_HANDLE &>(*hFile);
+  fflush(file_handle.f);  // the view must see what was written with WriteFile()
+
+  const int fd = dup(fileno(file_handle.f));
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  return new FILE_MAPPING_HANDLE(fd, flProtect);
+}
+
+LPVOID MapViewOfFile(HANDLE hFileMappingObject, DWORD dwDesiredAccess,
+                     DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap)
+{
+  const FILE_MAPPING_HANDLE & mapping = dynamic_cast<FILE_MAPPING_HANDLE &>(*hFileMappingObject);
+
+  size_t size = dwNumberOfBytesToMap;
+  if (size == 0)
+  {
+    // the whole file
+    struct stat st;
+    if (fstat(mapping.fd, &st) != 0 || st.st_size <= 0)
+    {
+      return nullptr;
+    }
+    size = st.st_size - dwFileOffsetLow;
+  }
+
+  int prot = PROT_READ;
+  int flags = MAP_SHARED;
+  if (dwDesiredAccess & FILE_MAP_COPY)
+  {
+    prot |= PROT_WRITE;
+    flags = MAP_PRIVATE;
+  }
+  else if ((dwDesiredAccess & FILE_MAP_WRITE) && mapping.flProtect == PAGE_READWRITE)
+  {
+    prot |= PROT_WRITE;
+  }
+
+  const off_t offset = (off_t(dwFileOffsetHigh) << 32) | dwFileOffsetLow;
+  void * view = mmap(nullptr, size, prot, flags, mapping.fd, offset);
+  if (view == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+  const std::lock_guard<std::mutex> lock(viewsMutex);
+  views[view] = size;
+  return view;
+}
+
+BOOL UnmapViewOfFile(LPCVOID lpBaseAddress)
+{
+  const std::lock_guard<std::mutex> lock(viewsMutex);
+  const auto it = views.find(lpBaseAddress);
+  if (it == views.end())
+  {
+    return FALSE;
+  }
+
+  const int res = munmap(const_cast<void *>(it->first), it->second);
+  views.erase(it);
+  return res == 0;
+}
+
 BOOL GetOpenFileName(LPOPENFILENAME lpofn)
 {
   return FALSE;
@@ -2,9 +2,11 @@
 
 #include "wincompat.h"
 #include "winhandles.h"
+#include "winbase.h"
 
 #define INVALID_FILE_ATTRIBUTES  (~0u)
 #define INVALID_SET_FILE_POINTER (~0u)
+#define INVALID_FILE_SIZE        (~0u)
 
 typedef struct tagOFN {
   DWORD         lStructSize;
@@ -71,4 +73,28 @@ HANDLE CreateFile(LPCTSTR               lpFileName,
 
 DWORD GetFileSize(HANDLE hFile, LPDWORD lpFileSizeHigh);
 
+#define PAGE_READONLY   0x02
+#define PAGE_READWRITE  0x04
+#define PAGE_WRITECOPY  0x08
+
+#define FILE_MAP_COPY   0x0001
+#define FILE_MAP_WRITE  0x0002
+#define FILE_MAP_READ   0x0004
+
+// only for files opened with CreateFile() (no paging file backed mappings)
+HANDLE CreateFileMapping(HANDLE hFile,
+                         LPSECURITY_ATTRIBUTES lpFileMappingAttributes,
+                         DWORD flProtect,
+                         DWORD dwMaximumSizeHigh,
+                         DWORD dwMaximumSizeLow,
+                         LPCTSTR lpName);
+
+LPVOID MapViewOfFile(HANDLE hFileMappingObject,
+                     DWORD dwDesiredAccess,
+                     DWORD dwFileOffsetHigh,
+                     DWORD dwFileOffsetLow,
+                     SIZE_T dwNumberOfBytesToMap);
+
+BOOL UnmapViewOfFile(LPCVOID lpBaseAddress);
+
 DWORD GetCurrentDirectory(DWORD, char *);
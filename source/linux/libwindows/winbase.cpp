@@ -92,9 +92,16 @@ HANDLE      WINAPI CreateThread(LPSECURITY_ATTRIBUTES,SIZE_T,LPTHREAD_START_ROUT
 
 BOOL WINAPI QueryPerformanceCounter(LARGE_INTEGER*counter)
 {
+  // PerfMarker times sections of ~1ms: milliseconds are too coarse
   const auto now = std::chrono::steady_clock::now();
-  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
-  counter->QuadPart = ms.count();
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
+  counter->QuadPart = ns.count();
+  return TRUE;
+}
+
+BOOL WINAPI QueryPerformanceFrequency(LARGE_INTEGER*frequency)
+{
+  frequency->QuadPart = 1000000000;
   return TRUE;
 }
 
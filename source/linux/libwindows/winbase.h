@@ -48,6 +48,7 @@ typedef union _LARGE_INTEGER {
 } LARGE_INTEGER;
 
 BOOL WINAPI QueryPerformanceCounter(LARGE_INTEGER*);
+BOOL WINAPI QueryPerformanceFrequency(LARGE_INTEGER*);
 
 HANDLE CreateSemaphore(
   LPSECURITY_ATTRIBUTES lpSemaphoreAttributes,
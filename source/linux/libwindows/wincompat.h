@@ -153,6 +153,7 @@ typedef ULONG_PTR       DWORD_PTR;
 
 typedef DWORD           LCID,       *PLCID;
 
+typedef __int64 INT64, *PINT64;
 typedef unsigned __int64 UINT64, *PUINT64;
 
 //
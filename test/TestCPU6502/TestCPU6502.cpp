@@ -11,9 +11,9 @@ enum AppMode_e g_nAppMode = MODE_RUNNING;
 SynchronousEventManager g_SynchronousEventMgr;
 
 // From Memory.cpp
+LPBYTE         memread[0x100];		// TODO: Init
 LPBYTE         memwrite[0x100];		// TODO: Init
 LPBYTE         mem          = NULL;	// TODO: Init
-LPBYTE         memdirty     = NULL;	// TODO: Init
 LPBYTE         memVidHD     = NULL;	// TODO: Init
 iofunction		IORead[256] = {0};	// TODO: Init
 iofunction		IOWrite[256] = {0};	// TODO: Init
@@ -26,6 +26,7 @@ BYTE __stdcall IO_F8xx(WORD programcounter, WORD address, BYTE write, BYTE value
 regsrec regs;
 
 bool g_irqOnLastOpcodeCycle = false;
+static bool g_bUpdateDue = false;
 
 static eCpuType g_ActiveCPU = CPU_65C02;
 
@@ -42,7 +43,7 @@ bool g_bStopOnBRK = false;
 
 static __forceinline int Fetch(BYTE& iOpcode, ULONG uExecutedCycles)
 {
-	iOpcode = *(mem+regs.pc);
+	iOpcode = ReadByteFromMemory(regs.pc);
 	regs.pc++;
 
 	if (iOpcode == 0x00 && g_bStopOnBRK)
@@ -113,9 +114,7 @@ void init(void)
 	mem = (LPBYTE)calloc(64, 1024);
 
 	for (UINT i=0; i<256; i++)
-		memwrite[i] = mem+i*256;
-
-	memdirty = new BYTE[256];
+		memread[i] = memwrite[i] = mem+i*256;
 }
 
 void reset(void)
@@ -1306,6 +1305,18 @@ int testCB(int id, int cycles, ULONG uExecutedCycles)
 	return 0;
 }
 
+static int g_syncEventOrder[8];
+static int g_syncEventCycles[8];
+static int g_syncEventCount = 0;
+
+int testOrderCB(int id, int cycles, ULONG uExecutedCycles)
+{
+	g_syncEventOrder[g_syncEventCount] = id;
+	g_syncEventCycles[g_syncEventCount] = cycles;
+	g_syncEventCount++;
+	return id == 1 ? 0x10 : 0;	// id1 repeats
+}
+
 int SyncEvents_test(void)
 {
 	SyncEvent syncEvent0(0, 0x10, testCB);
@@ -1318,16 +1329,19 @@ int SyncEvents_test(void)
 	g_SynchronousEventMgr.Insert(&syncEvent2);
 	g_SynchronousEventMgr.Insert(&syncEvent3);
 	// id0 -> id1 -> id2 -> id3
-	if (syncEvent0.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent1.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent2.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent3.m_cyclesRemaining != 0x10) return 1;
+	if (g_SynchronousEventMgr.GetHead() != &syncEvent0) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent0) != 0x10) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent1) != 0x20) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent2) != 0x30) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent3) != 0x40) return 1;
 
 	g_SynchronousEventMgr.Remove(1);
 	g_SynchronousEventMgr.Remove(3);
 	g_SynchronousEventMgr.Remove(0);
-	if (syncEvent2.m_cyclesRemaining != 0x30) return 1;
+	if (g_SynchronousEventMgr.GetHead() != &syncEvent2) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent2) != 0x30) return 1;
 	g_SynchronousEventMgr.Remove(2);
+	if (g_SynchronousEventMgr.GetHead() != NULL) return 1;
 
 	//
 
@@ -1341,17 +1355,50 @@ int SyncEvents_test(void)
 	g_SynchronousEventMgr.Insert(&syncEvent2);
 	g_SynchronousEventMgr.Insert(&syncEvent3);
 	// id3 -> id2 -> id1 -> id0
-	if (syncEvent0.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent1.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent2.m_cyclesRemaining != 0x10) return 1;
-	if (syncEvent3.m_cyclesRemaining != 0x10) return 1;
+	if (g_SynchronousEventMgr.GetHead() != &syncEvent3) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent0) != 0x40) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent1) != 0x30) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent2) != 0x20) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent3) != 0x10) return 1;
 
 	g_SynchronousEventMgr.Remove(3);
 	g_SynchronousEventMgr.Remove(0);
 	g_SynchronousEventMgr.Remove(1);
-	if (syncEvent2.m_cyclesRemaining != 0x20) return 1;
+	if (g_SynchronousEventMgr.GetHead() != &syncEvent2) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent2) != 0x20) return 1;
 	g_SynchronousEventMgr.Remove(2);
 
+	//
+
+	// Update(): events expiring on the same cycle fire in insertion order,
+	// and each subsequent callback gets the previous event's underflow cycles
+	SyncEvent syncEvent4(0, 0x20, testOrderCB);
+	SyncEvent syncEvent5(1, 0x10, testOrderCB);
+	SyncEvent syncEvent6(2, 0x20, testOrderCB);
+	SyncEvent syncEvent7(3, 0x30, testOrderCB);
+
+	g_SynchronousEventMgr.Insert(&syncEvent4);
+	g_SynchronousEventMgr.Insert(&syncEvent5);
+	g_SynchronousEventMgr.Insert(&syncEvent6);
+	g_SynchronousEventMgr.Insert(&syncEvent7);
+
+	g_syncEventCount = 0;
+	g_SynchronousEventMgr.Update(0x0F, 0);
+	if (g_syncEventCount != 0) return 1;
+
+	g_SynchronousEventMgr.Update(0x13, 0);	// now = 0x22
+	if (g_syncEventCount != 3) return 1;
+	if (g_syncEventOrder[0] != 1 || g_syncEventCycles[0] != 0x13) return 1;
+	if (g_syncEventOrder[1] != 0 || g_syncEventCycles[1] != 0x12) return 1;
+	if (g_syncEventOrder[2] != 2 || g_syncEventCycles[2] != 0x02) return 1;
+	if (!syncEvent5.m_active || syncEvent4.m_active || syncEvent6.m_active) return 1;
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent5) != 0x10) return 1;	// re-added relative to end of opcode
+	if (g_SynchronousEventMgr.GetCyclesRemaining(&syncEvent7) != 0x0E) return 1;
+
+	g_SynchronousEventMgr.Remove(1);
+	g_SynchronousEventMgr.Remove(3);
+	if (g_SynchronousEventMgr.GetHead() != NULL) return 1;
+
 	return 0;
 }
 
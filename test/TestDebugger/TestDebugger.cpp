@@ -40,8 +40,8 @@ eCpuType GetMainCpu(void)
 }
 
 // From Memory.cpp
+LPBYTE         memread[0x100];		// TODO: Init
 LPBYTE         mem          = NULL;	// TODO: Init
-LPBYTE         memdirty     = NULL;	// TODO: Init
 
 //-------------------------------------
 
@@ -85,6 +85,9 @@ bool FindAddressFromSymbol ( const char* pSymbol, WORD * pAddress_, int * iTable
 void init(void)
 {
 	mem = (LPBYTE)VirtualAlloc(NULL,128*1024,MEM_COMMIT,PAGE_READWRITE);	// alloc >64K to test wrap-around at 64K boundary
+
+	for (UINT i=0; i<256; i++)
+		memread[i] = mem+i*256;
 }
 
 void reset(void)
@@ -0,0 +1,103 @@
+#include "frontends/common2/framecapture.h"
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h>
+
+// Round trip: frames pushed to a FrameCapture are decoded unchanged by a FrameCaptureReader
+
+namespace
+{
+  using common2::FrameCapture;
+  using common2::FrameCaptureReader;
+
+  const size_t numFrames = 50;
+
+  void makeFrame(const size_t i, FrameCapture::Frame & frame)
+  {
+    // a resize half way (key frame), some unchanged frames (empty delta) and a moving block
+    frame.number = 1000 + i * 2;
+    frame.width = i < numFrames / 2 ? 64 : 80;
+    frame.height = 48;
+    frame.pixels.assign(frame.width * frame.height * sizeof(uint32_t), 0x11);
+    const size_t x = (i / 3) % frame.width;
+    for (size_t y = 0; y < 8; ++y)
+    {
+      memset(frame.pixels.data() + (y * frame.width + x) * sizeof(uint32_t), int(0x40 + i / 3), sizeof(uint32_t));
+    }
+  }
+
+  int TestRoundTrip(const std::string & filename, const bool dropWhenFull)
+  {
+    {
+      // a queue of 1 means the writer is (almost) always behind
+      FrameCapture capture(filename, 1, 7, dropWhenFull);
+      FrameCapture::Frame frame;
+      for (size_t i = 0; i < numFrames; ++i)
+      {
+        makeFrame(i, frame);
+        capture.push(frame.pixels.data(), frame.width, frame.height, frame.number);
+      }
+      if (!dropWhenFull && capture.getNumberOfFramesDropped() != 0)
+        return 1;
+    }
+
+    FrameCaptureReader reader(filename);
+    if (!dropWhenFull && reader.getNumberOfRecords() != numFrames)
+      return 1;
+
+    FrameCapture::Frame decoded = {};
+    FrameCapture::Frame expected;
+    for (size_t record = 0; record < reader.getNumberOfRecords(); ++record)
+    {
+      if (!reader.read(record, decoded))
+        return 1;
+
+      const size_t i = (decoded.number - 1000) / 2;
+      makeFrame(i, expected);
+      if (decoded.number != expected.number || decoded.width != expected.width || decoded.height != expected.height || decoded.pixels != expected.pixels)
+        return 1;
+    }
+
+    // random access: decoded from the key frame before it
+    FrameCapture::Frame last = {};
+    if (!reader.read(reader.getNumberOfRecords() - 1, last) || last.pixels != decoded.pixels)
+      return 1;
+
+    return 0;
+  }
+
+  int TestNotACapture(const std::string & filename)
+  {
+    FILE * file = fopen(filename.c_str(), "wb");
+    fputs("not a capture", file);
+    fclose(file);
+
+    try
+    {
+      FrameCaptureReader reader(filename);
+    }
+    catch (const std::runtime_error &)
+    {
+      return 0;
+    }
+    return 1;
+  }
+}
+
+int main(int argc, char * argv[])
+{
+  char filename[] = "/tmp/testframecaptureXXXXXX";
+  const int fd = mkstemp(filename);
+  if (fd < 0)
+    return 1;
+  close(fd);
+
+  int res = TestRoundTrip(filename, false);
+  if (!res) res = TestRoundTrip(filename, true);
+  if (!res) res = TestNotACapture(filename);
+
+  unlink(filename);
+  return res;
+}